@@ -0,0 +1,169 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../single-linked-list/single-linked-list.h"
+
+// Минималистичный бенчмарк-раннер в духе Google Benchmark: каждая функция
+// прогоняется до стабилизации, печатается время на операцию. Внешних
+// зависимостей нет, поэтому харнес собирается так же, как main.cpp:
+//   g++ -std=c++17 -O2 benchmarks/benchmarks.cpp -o benchmarks/benchmarks
+// По умолчанию размеры ограничены 64K элементов; флаг --full добавляет
+// прогоны на 1M и 10M для охоты за регрессиями на больших списках.
+
+namespace {
+
+// Не даёт компилятору выбросить вычисление результата
+template <typename T>
+void DoNotOptimize(const T& value) {
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+using Clock = std::chrono::steady_clock;
+
+// Запускает body(), пока суммарное время не станет измеримым,
+// и печатает наносекунды в пересчёте на элемент
+template <typename Body>
+void RunBenchmark(const std::string& name, size_t elements, Body body) {
+    // Прогрев
+    body();
+
+    size_t repetitions = 1;
+    double elapsed_ns = 0;
+    for (;;) {
+        const auto start = Clock::now();
+        for (size_t i = 0; i < repetitions; ++i) {
+            body();
+        }
+        elapsed_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        if (elapsed_ns >= 1e7 || repetitions >= 1u << 20) {
+            break;
+        }
+        repetitions *= 2;
+    }
+    const double ns_per_element = elapsed_ns / static_cast<double>(repetitions) / static_cast<double>(elements);
+    std::cout << name << "/" << elements << "\t" << ns_per_element << " ns/elem\n";
+}
+
+// 64-байтовая POD-нагрузка — размер одной кэш-линии
+struct Pod64 {
+    int64_t fields[8];
+
+    bool operator==(const Pod64& rhs) const {
+        return std::memcmp(fields, rhs.fields, sizeof(fields)) == 0;
+    }
+};
+
+template <typename Type>
+Type MakePayload(int seed);
+
+template <>
+int MakePayload<int>(int seed) {
+    return seed;
+}
+
+template <>
+Pod64 MakePayload<Pod64>(int seed) {
+    Pod64 value{};
+    value.fields[0] = seed;
+    return value;
+}
+
+template <>
+std::string MakePayload<std::string>(int seed) {
+    return std::string(32, static_cast<char>('a' + seed % 26));
+}
+
+template <typename Type>
+SingleLinkedList<Type> MakeList(size_t elements) {
+    SingleLinkedList<Type> list;
+    for (size_t i = 0; i < elements; ++i) {
+        list.PushFront(MakePayload<Type>(static_cast<int>(i)));
+    }
+    return list;
+}
+
+template <typename Type>
+void BenchmarkOperations(const std::string& payload_name, size_t elements) {
+    RunBenchmark("PushFront<" + payload_name + ">", elements, [elements] {
+        SingleLinkedList<Type> list;
+        for (size_t i = 0; i < elements; ++i) {
+            list.PushFront(MakePayload<Type>(static_cast<int>(i)));
+        }
+        DoNotOptimize(list.GetSize());
+    });
+
+    RunBenchmark("InsertAfter<" + payload_name + ">", elements, [elements] {
+        SingleLinkedList<Type> list;
+        auto pos = list.cbefore_begin();
+        for (size_t i = 0; i < elements; ++i) {
+            pos = list.InsertAfter(pos, MakePayload<Type>(static_cast<int>(i)));
+        }
+        DoNotOptimize(list.GetSize());
+    });
+
+    RunBenchmark("EraseAfter<" + payload_name + ">", elements, [elements] {
+        SingleLinkedList<Type> list = MakeList<Type>(elements);
+        while (!list.IsEmpty()) {
+            list.EraseAfter(list.cbefore_begin());
+        }
+        DoNotOptimize(list.GetSize());
+    });
+
+    RunBenchmark("Clear<" + payload_name + ">", elements, [elements] {
+        SingleLinkedList<Type> list = MakeList<Type>(elements);
+        list.Clear();
+        DoNotOptimize(list.GetSize());
+    });
+
+    {
+        const SingleLinkedList<Type> list = MakeList<Type>(elements);
+        RunBenchmark("Iterate<" + payload_name + ">", elements, [&list] {
+            size_t count = 0;
+            for (auto it = list.begin(); it != list.end(); ++it) {
+                ++count;
+            }
+            DoNotOptimize(count);
+        });
+
+        RunBenchmark("CopyConstruct<" + payload_name + ">", elements, [&list] {
+            SingleLinkedList<Type> copy(list);
+            DoNotOptimize(copy.GetSize());
+        });
+
+        const SingleLinkedList<Type> same(list);
+        RunBenchmark("Equality<" + payload_name + ">", elements, [&list, &same] {
+            DoNotOptimize(list == same);
+        });
+    }
+}
+
+void BenchmarkComparisons(size_t elements) {
+    const SingleLinkedList<int> lhs = MakeList<int>(elements);
+    const SingleLinkedList<int> rhs(lhs);
+    RunBenchmark("LessThan<int>", elements, [&lhs, &rhs] {
+        DoNotOptimize(lhs < rhs);
+        DoNotOptimize(lhs <= rhs);
+    });
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<size_t> sizes{16, 256, 4096, 65536};
+    if (argc > 1 && std::string(argv[1]) == "--full") {
+        sizes.push_back(1u << 20);
+        sizes.push_back(10'000'000);
+    }
+
+    for (size_t elements : sizes) {
+        BenchmarkOperations<int>("int", elements);
+        BenchmarkOperations<Pod64>("Pod64", elements);
+        BenchmarkOperations<std::string>("string", elements);
+        BenchmarkComparisons(elements);
+        std::cout << "\n";
+    }
+}
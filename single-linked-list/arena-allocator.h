@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// Монотонная арена: выдаёт память простым смещением указателя внутри крупных
+// блоков и освобождает все блоки разом в Release(). Отдельные освобождения
+// не поддерживаются — арена рассчитана на контейнеры со временем жизни
+// "создали, наполнили, выбросили целиком".
+class MonotonicArena {
+public:
+    explicit MonotonicArena(size_t block_size = 4096)
+        : block_size_(block_size) {
+    }
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    ~MonotonicArena() {
+        Release();
+    }
+
+    void* Allocate(size_t bytes, size_t alignment) {
+        size_t padding = reinterpret_cast<size_t>(current_) % alignment;
+        if (padding != 0) {
+            padding = alignment - padding;
+        }
+        if (remaining_ < bytes + padding) {
+            AllocateBlock(bytes + alignment);
+            padding = reinterpret_cast<size_t>(current_) % alignment;
+            if (padding != 0) {
+                padding = alignment - padding;
+            }
+        }
+        char* result = current_ + padding;
+        current_ = result + bytes;
+        remaining_ -= bytes + padding;
+        return result;
+    }
+
+    // Освобождает все блоки арены за один проход по их списку.
+    // Все ранее выданные указатели становятся недействительными
+    void Release() noexcept {
+        while (blocks_) {
+            BlockHeader* next_block = blocks_->next_block;
+            ::operator delete(blocks_);
+            blocks_ = next_block;
+        }
+        current_ = nullptr;
+        remaining_ = 0;
+    }
+
+private:
+    struct BlockHeader {
+        BlockHeader* next_block = nullptr;
+    };
+
+    void AllocateBlock(size_t min_bytes) {
+        size_t payload_size = std::max(block_size_, min_bytes);
+        auto* block = static_cast<BlockHeader*>(::operator new(sizeof(BlockHeader) + payload_size));
+        block->next_block = blocks_;
+        blocks_ = block;
+        current_ = reinterpret_cast<char*>(block) + sizeof(BlockHeader);
+        remaining_ = payload_size;
+    }
+
+    BlockHeader* blocks_ = nullptr;
+    char* current_ = nullptr;
+    size_t remaining_ = 0;
+    size_t block_size_;
+};
+
+// Аллокатор поверх MonotonicArena. deallocate — пустая операция: память
+// возвращается целиком через ReleaseAll(). Контейнер, владеющий ареной
+// монопольно, может использовать ReleaseAll() для сброса за O(1)
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(MonotonicArena& arena) noexcept
+        : arena_(&arena) {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+        : arena_(other.arena_) {
+    }
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {
+        // Память вернётся в систему при ReleaseAll()
+    }
+
+    void ReleaseAll() noexcept {
+        arena_->Release();
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& rhs) const noexcept {
+        return arena_ == rhs.arena_;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+    MonotonicArena* arena_;
+};
@@ -0,0 +1,298 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+// Конкурентный односвязный список для схемы "много производителей — один
+// потребитель" (MPSC): PushFront — лок-фри CAS по атомарной голове в стиле
+// стека Трейбера, потребитель забирает всю цепочку одним exchange через
+// StealAll() и обходит её обычными однопоточными итераторами. Элементы
+// отдаются в порядке LIFO. Мьютексов нет вовсе
+template <typename Type>
+class ConcurrentSingleLinkedList {
+    struct Node {
+        template <typename... Args>
+        explicit Node(Node* next, Args&&... args)
+            : value(std::forward<Args>(args)...)
+            , next_node(next) {
+        }
+        Type value;
+        Node* next_node = nullptr;
+        // Связь списка отложенной утилизации. Отдельное поле, потому что
+        // активные читатели могут продолжать ходить по next_node
+        // отцепленного узла до кванта покоя
+        Node* retired_next = nullptr;
+    };
+
+    template <typename ValueType>
+    class BasicIterator {
+    friend class ConcurrentSingleLinkedList;
+
+        explicit BasicIterator(Node* node) : node_(node) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        [[nodiscard]] bool operator==(const BasicIterator& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator& rhs) const noexcept {
+            return node_ != rhs.node_;
+        }
+
+        BasicIterator& operator++() noexcept {
+            assert(node_ != nullptr);
+
+            node_ = node_->next_node;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old_copy(node_);
+            ++(*this);
+            return old_copy;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(node_ != nullptr);
+
+            return node_->value;
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            assert(node_ != nullptr);
+
+            return &node_->value;
+        }
+
+    private:
+        Node* node_ = nullptr;
+    };
+
+public:
+    using value_type = Type;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Владеющая цепочка, украденная у конкурентного списка одним exchange.
+    // Дальше с ней работает один поток: обход обычными итераторами,
+    // узлы освобождаются в деструкторе
+    class StolenChain {
+    friend class ConcurrentSingleLinkedList;
+
+        explicit StolenChain(Node* first) : first_(first) {
+        }
+
+    public:
+        StolenChain(const StolenChain&) = delete;
+        StolenChain& operator=(const StolenChain&) = delete;
+
+        StolenChain(StolenChain&& other) noexcept
+            : first_(other.first_) {
+            other.first_ = nullptr;
+        }
+
+        StolenChain& operator=(StolenChain&& rhs) noexcept {
+            if (this != &rhs) {
+                Release();
+                first_ = rhs.first_;
+                rhs.first_ = nullptr;
+            }
+            return *this;
+        }
+
+        [[nodiscard]] Iterator begin() noexcept {
+            return Iterator{first_};
+        }
+
+        [[nodiscard]] Iterator end() noexcept {
+            return Iterator{nullptr};
+        }
+
+        [[nodiscard]] bool IsEmpty() const noexcept {
+            return first_ == nullptr;
+        }
+
+        ~StolenChain() {
+            Release();
+        }
+
+    private:
+        void Release() noexcept {
+            while (first_) {
+                Node* next_node = first_->next_node;
+                delete first_;
+                first_ = next_node;
+            }
+        }
+
+        Node* first_ = nullptr;
+    };
+
+    ConcurrentSingleLinkedList() = default;
+
+    ConcurrentSingleLinkedList(const ConcurrentSingleLinkedList&) = delete;
+    ConcurrentSingleLinkedList& operator=(const ConcurrentSingleLinkedList&) = delete;
+
+    void PushFront(const Type& value) {
+        EmplaceFront(value);
+    }
+
+    void PushFront(Type&& value) {
+        EmplaceFront(std::move(value));
+    }
+
+    // Лок-фри вставка в начало: узел готовится заранее, затем
+    // публикуется одним CAS. Можно звать из любого числа потоков
+    template <typename... Args>
+    void EmplaceFront(Args&&... args) {
+        Node* new_node = new Node(head_.load(std::memory_order_relaxed), std::forward<Args>(args)...);
+        while (!head_.compare_exchange_weak(new_node->next_node, new_node,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+            // next_node обновлён текущей головой, пробуем снова
+        }
+    }
+
+    // RAII-регистрация читателя: пока жив хоть один ReadGuard, узлы,
+    // снятые PopFront, не освобождаются, а лишь откладываются в список
+    // отложенной утилизации. Это позволяет сканировать список
+    // одновременно с изъятием элементов без копий и блокировок
+    class ReadGuard {
+    friend class ConcurrentSingleLinkedList;
+
+        explicit ReadGuard(ConcurrentSingleLinkedList& list) noexcept
+            : list_(&list) {
+            list_->active_readers_.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+    public:
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        [[nodiscard]] Iterator begin() const noexcept {
+            return Iterator{list_->head_.load(std::memory_order_acquire)};
+        }
+
+        [[nodiscard]] Iterator end() const noexcept {
+            return Iterator{nullptr};
+        }
+
+        ~ReadGuard() {
+            list_->active_readers_.fetch_sub(1, std::memory_order_release);
+        }
+
+    private:
+        ConcurrentSingleLinkedList* list_;
+    };
+
+    // Открывает защищённую секцию чтения; итерация идёт по снимку
+    // головы на момент begin()
+    [[nodiscard]] ReadGuard ReadLock() noexcept {
+        return ReadGuard(*this);
+    }
+
+    // Лок-фри изъятие первого элемента. Узел не удаляется сразу:
+    // он уходит в список отложенной утилизации и будет освобождён,
+    // когда не останется активных читателей
+    std::optional<Type> PopFront() {
+        // Регистрируемся как читатель: пока CAS-цикл держит указатель
+        // на узел, конкурентный PopFront не должен его освободить
+        active_readers_.fetch_add(1, std::memory_order_acq_rel);
+        Node* old_head = head_.load(std::memory_order_acquire);
+        while (old_head != nullptr
+               && !head_.compare_exchange_weak(old_head, old_head->next_node,
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_acquire)) {
+        }
+        std::optional<Type> result;
+        if (old_head != nullptr) {
+            // Копируем, а не перемещаем: читатель, начавший обход до CAS,
+            // всё ещё может читать значение этого узла
+            result = old_head->value;
+        }
+        active_readers_.fetch_sub(1, std::memory_order_release);
+        if (old_head != nullptr) {
+            Retire(old_head);
+            TryReclaim();
+        }
+        return result;
+    }
+
+    // Пытается освободить отложенные узлы. Безопасность: узлы в списке
+    // утилизации уже отцеплены от головы, поэтому читатель, пришедший
+    // после exchange, до них не доберётся; если счётчик читателей нулевой
+    // после exchange, то и старых держателей не осталось
+    void TryReclaim() noexcept {
+        Node* grabbed = retired_.exchange(nullptr, std::memory_order_acquire);
+        if (grabbed == nullptr) {
+            return;
+        }
+        if (active_readers_.load(std::memory_order_acquire) == 0) {
+            while (grabbed) {
+                Node* next_retired = grabbed->retired_next;
+                delete grabbed;
+                grabbed = next_retired;
+            }
+            return;
+        }
+        // Читатели ещё работают — возвращаем цепочку обратно
+        Node* chain_tail = grabbed;
+        while (chain_tail->retired_next != nullptr) {
+            chain_tail = chain_tail->retired_next;
+        }
+        chain_tail->retired_next = retired_.load(std::memory_order_relaxed);
+        while (!retired_.compare_exchange_weak(chain_tail->retired_next, grabbed,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+        }
+    }
+
+    // Забирает всю цепочку одним атомарным exchange; список мгновенно
+    // пустеет, а производители продолжают наполнять его без пауз.
+    // Несовместимо с активными ReadGuard: украденные узлы освобождаются
+    // деструктором StolenChain немедленно
+    [[nodiscard]] StolenChain StealAll() noexcept {
+        return StolenChain{head_.exchange(nullptr, std::memory_order_acquire)};
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return head_.load(std::memory_order_acquire) == nullptr;
+    }
+
+    ~ConcurrentSingleLinkedList() {
+        // Забираем остаток цепочки; временный StolenChain освободит узлы
+        auto remainder = StealAll();
+        static_cast<void>(remainder);
+        // К этому моменту читателей быть не может — добиваем отложенные узлы
+        assert(active_readers_.load(std::memory_order_acquire) == 0);
+        TryReclaim();
+    }
+
+private:
+    // Откладывает отцепленный узел в список утилизации; next_node узла
+    // не трогаем — по нему ещё могут идти читатели
+    void Retire(Node* node) noexcept {
+        node->retired_next = retired_.load(std::memory_order_relaxed);
+        while (!retired_.compare_exchange_weak(node->retired_next, node,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+        }
+    }
+
+    std::atomic<Node*> head_{nullptr};
+    std::atomic<Node*> retired_{nullptr};
+    std::atomic<size_t> active_readers_{0};
+};
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "single-linked-list.h"
+
+// Замороженный список: элементы лежат подряд в одном буфере в порядке
+// обхода, "следующий узел" — это просто соседний адрес. Обход не делает
+// ни одного зависимого разыменования указателя, а сам буфер пригоден для
+// отображения в память и разделения между процессами. Интерфейс итераторов
+// повторяет BasicIterator из SingleLinkedList; список только для чтения
+template <typename Type>
+class FrozenSingleLinkedList {
+    template <typename ValueType>
+    class BasicIterator {
+    friend class FrozenSingleLinkedList;
+
+        explicit BasicIterator(const Type* ptr) : ptr_(ptr) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const ValueType*;
+        using reference = const ValueType&;
+
+        BasicIterator() = default;
+
+        [[nodiscard]] bool operator==(const BasicIterator& rhs) const noexcept {
+            return ptr_ == rhs.ptr_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator& rhs) const noexcept {
+            return ptr_ != rhs.ptr_;
+        }
+
+        BasicIterator& operator++() noexcept {
+            assert(ptr_ != nullptr);
+
+            ++ptr_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old_copy(ptr_);
+            ++(*this);
+            return old_copy;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(ptr_ != nullptr);
+
+            return *ptr_;
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            assert(ptr_ != nullptr);
+
+            return ptr_;
+        }
+
+    private:
+        const Type* ptr_ = nullptr;
+    };
+
+public:
+    using value_type = Type;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<const Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    FrozenSingleLinkedList() = default;
+
+    // Копирование и перемещение восстанавливают data_: у владеющего
+    // списка буфер переезжает вместе с vector
+    FrozenSingleLinkedList(const FrozenSingleLinkedList& other)
+        : storage_(other.storage_)
+        , data_(other.storage_.empty() ? other.data_ : storage_.data())
+        , size_(other.size_) {
+    }
+
+    FrozenSingleLinkedList(FrozenSingleLinkedList&& other) noexcept
+        : storage_(std::move(other.storage_))
+        , data_(other.data_)
+        , size_(other.size_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    FrozenSingleLinkedList& operator=(const FrozenSingleLinkedList& rhs) {
+        if (this != &rhs) {
+            FrozenSingleLinkedList copy_rhs(rhs);
+            *this = std::move(copy_rhs);
+        }
+        return *this;
+    }
+
+    FrozenSingleLinkedList& operator=(FrozenSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            storage_ = std::move(rhs.storage_);
+            data_ = rhs.data_;
+            size_ = rhs.size_;
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+        }
+        return *this;
+    }
+
+    // Замораживает обычный список: один проход копирует элементы
+    // в непрерывный буфер в порядке обхода
+    template <typename Allocator>
+    static FrozenSingleLinkedList Freeze(const SingleLinkedList<Type, Allocator>& source) {
+        FrozenSingleLinkedList result;
+        result.storage_.reserve(source.GetSize());
+        for (const Type& value : source) {
+            result.storage_.push_back(value);
+        }
+        result.data_ = result.storage_.data();
+        result.size_ = result.storage_.size();
+        return result;
+    }
+
+    // Невладеющее представление поверх готового буфера в формате
+    // Serialize (префикс uint64_t + элементы подряд), например поверх
+    // отображённого в память файла. Буфер должен жить дольше списка
+    static FrozenSingleLinkedList View(const void* data, size_t size) {
+        static_assert(std::is_trivially_copyable_v<Type>,
+                      "View requires a trivially copyable Type");
+
+        const char* bytes = static_cast<const char*>(data);
+        uint64_t count = 0;
+        if (size < sizeof(count)) {
+            throw std::runtime_error("FrozenSingleLinkedList::View: buffer too small for element count");
+        }
+        std::memcpy(&count, bytes, sizeof(count));
+        // Проверка делением: произведение count * sizeof(Type) для
+        // враждебного префикса переполняется и обходит сравнение
+        if (count > (size - sizeof(count)) / sizeof(Type)) {
+            throw std::runtime_error("FrozenSingleLinkedList::View: truncated element data");
+        }
+        FrozenSingleLinkedList result;
+        result.data_ = reinterpret_cast<const Type*>(bytes + sizeof(count));
+        result.size_ = count;
+        return result;
+    }
+
+    // Оттаивание: собирает обычный изменяемый список из буфера
+    [[nodiscard]] SingleLinkedList<Type> Thaw() const {
+        return SingleLinkedList<Type>(begin(), end());
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return ConstIterator{data_};
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return ConstIterator{data_ + size_};
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    // Прямой доступ к непрерывному массиву значений — для передачи
+    // в численные процедуры, работающие с сырыми буферами
+    [[nodiscard]] const Type* Data() const noexcept {
+        return data_;
+    }
+
+    // Сумма элементов линейным проходом по непрерывному буферу;
+    // такой цикл компилятор векторизует. Только для арифметических типов
+    template <typename U = Type, typename = std::enable_if_t<std::is_arithmetic_v<U>>>
+    [[nodiscard]] Type Sum() const noexcept {
+        Type total{};
+        for (size_t i = 0; i < size_; ++i) {
+            total += data_[i];
+        }
+        return total;
+    }
+
+    // Минимум и максимум за один проход. Список не должен быть пустым
+    template <typename U = Type, typename = std::enable_if_t<std::is_arithmetic_v<U>>>
+    [[nodiscard]] std::pair<Type, Type> MinMax() const noexcept {
+        assert(!IsEmpty());
+
+        Type lowest = data_[0];
+        Type highest = data_[0];
+        for (size_t i = 1; i < size_; ++i) {
+            lowest = data_[i] < lowest ? data_[i] : lowest;
+            highest = highest < data_[i] ? data_[i] : highest;
+        }
+        return {lowest, highest};
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+private:
+    // Владеющий буфер; пуст у невладеющих представлений
+    std::vector<Type> storage_;
+    const Type* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+template <typename Type>
+bool operator==(const FrozenSingleLinkedList<Type>& lhs, const FrozenSingleLinkedList<Type>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type>
+bool operator!=(const FrozenSingleLinkedList<Type>& lhs, const FrozenSingleLinkedList<Type>& rhs) {
+    return !(lhs == rhs);
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+
+// Встроенный пул: фиксированный буфер прямо в объекте пула, обычно на стеке
+// рядом с коротким списком. Первые выделения идут смещением указателя внутри
+// буфера, освобождённые слоты уходят в свободный список и переиспользуются;
+// когда буфер исчерпан, аллокатор прозрачно переходит на кучу. Короткие
+// списки (несколько элементов) при таком размещении вовсе не трогают кучу
+template <size_t Capacity>
+class InlinePool {
+public:
+    InlinePool() = default;
+
+    InlinePool(const InlinePool&) = delete;
+    InlinePool& operator=(const InlinePool&) = delete;
+
+    // Выдаёт слот из буфера либо nullptr, если места нет — тогда
+    // вызывающий обязан взять память из кучи. Все запросы списка имеют
+    // одинаковый размер (узел), поэтому свободный список хранит слоты
+    // единого размера
+    void* Allocate(size_t bytes, size_t alignment) {
+        if (free_slots_ != nullptr && bytes <= slot_size_) {
+            FreeSlot* slot = free_slots_;
+            free_slots_ = slot->next_slot;
+            return slot;
+        }
+        size_t padding = reinterpret_cast<size_t>(buffer_ + used_) % alignment;
+        if (padding != 0) {
+            padding = alignment - padding;
+        }
+        if (Capacity - used_ < bytes + padding) {
+            return nullptr;
+        }
+        char* result = buffer_ + used_ + padding;
+        used_ += bytes + padding;
+        slot_size_ = bytes;
+        return result;
+    }
+
+    // Возвращает слот в свободный список для переиспользования.
+    // Звать только для указателей, выданных этим пулом
+    void Deallocate(void* ptr) noexcept {
+        assert(Owns(ptr));
+
+        // Слишком маленький слот не вместит связь свободного списка —
+        // такие просто теряются до конца жизни пула
+        if (slot_size_ < sizeof(FreeSlot)) {
+            return;
+        }
+        auto* slot = static_cast<FreeSlot*>(ptr);
+        slot->next_slot = free_slots_;
+        free_slots_ = slot;
+    }
+
+    // Принадлежит ли указатель буферу пула: по нему аллокатор решает,
+    // вернуть слот в пул или отдать память куче
+    [[nodiscard]] bool Owns(const void* ptr) const noexcept {
+        const char* byte_ptr = static_cast<const char*>(ptr);
+        return byte_ptr >= buffer_ && byte_ptr < buffer_ + Capacity;
+    }
+
+private:
+    struct FreeSlot {
+        FreeSlot* next_slot = nullptr;
+    };
+
+    alignas(alignof(std::max_align_t)) char buffer_[Capacity];
+    size_t used_ = 0;
+    // Размер слота фиксируется первым выделением; свободный список
+    // переиспользуется только для запросов не больше него
+    size_t slot_size_ = 0;
+    FreeSlot* free_slots_ = nullptr;
+};
+
+// Аллокатор поверх InlinePool: пока в буфере есть место, узлы размещаются
+// в нём, дальше — обычный new. deallocate различает происхождение указателя
+// через Owns(). Пул должен пережить все контейнеры, которые им пользуются
+template <typename T, size_t Capacity>
+class InlinePoolAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = InlinePoolAllocator<U, Capacity>;
+    };
+
+    explicit InlinePoolAllocator(InlinePool<Capacity>& pool) noexcept
+        : pool_(&pool) {
+    }
+
+    template <typename U>
+    InlinePoolAllocator(const InlinePoolAllocator<U, Capacity>& other) noexcept
+        : pool_(other.pool_) {
+    }
+
+    T* allocate(size_t n) {
+        if (n == 1) {
+            if (void* slot = pool_->Allocate(sizeof(T), alignof(T))) {
+                return static_cast<T*>(slot);
+            }
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, size_t) noexcept {
+        if (pool_->Owns(ptr)) {
+            pool_->Deallocate(ptr);
+        } else {
+            ::operator delete(ptr);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const InlinePoolAllocator<U, Capacity>& rhs) const noexcept {
+        return pool_ == rhs.pool_;
+    }
+
+    template <typename U>
+    bool operator!=(const InlinePoolAllocator<U, Capacity>& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+    InlinePool<Capacity>* pool_;
+};
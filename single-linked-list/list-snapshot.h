@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "single-linked-list.h"
+
+// Неизменяемый снимок списка для раздачи множеству потребителей.
+// Take() копирует цепочку один раз; дальше снимок раздаётся копированием
+// дескриптора за O(1) — все копии разделяют одну цепочку под счётчиком
+// ссылок. Читают потребители через ConstIterator; тот, кому нужно менять
+// данные, вызывает Fork() и получает собственный изменяемый список —
+// узлы копируются только в этот момент и только для него
+template <typename Type>
+class ListSnapshot {
+public:
+    using value_type = Type;
+    using ConstIterator = typename SingleLinkedList<Type>::ConstIterator;
+
+    ListSnapshot() = default;
+
+    // Единственная полная копия цепочки; все дальнейшие раздачи
+    // этого снимка — копии умного указателя
+    [[nodiscard]] static ListSnapshot Take(const SingleLinkedList<Type>& source) {
+        ListSnapshot snapshot;
+        snapshot.shared_ = std::make_shared<const SingleLinkedList<Type>>(source);
+        return snapshot;
+    }
+
+    // Забирает список без копирования узлов: снимок становится
+    // единственным владельцем перемещённой цепочки
+    [[nodiscard]] static ListSnapshot Take(SingleLinkedList<Type>&& source) {
+        ListSnapshot snapshot;
+        snapshot.shared_ = std::make_shared<const SingleLinkedList<Type>>(std::move(source));
+        return snapshot;
+    }
+
+    // Изменяемая копия для потребителя, которому нужно мутировать данные.
+    // Остальные держатели снимка продолжают читать прежнюю цепочку
+    [[nodiscard]] SingleLinkedList<Type> Fork() const {
+        return shared_ ? SingleLinkedList<Type>(*shared_) : SingleLinkedList<Type>{};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return shared_ ? shared_->begin() : ConstIterator{};
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return shared_ ? shared_->end() : ConstIterator{};
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return shared_ ? shared_->GetSize() : 0;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    // Сколько дескрипторов разделяют эту цепочку — удобно для проверки,
+    // что раздача действительно не копирует узлы
+    [[nodiscard]] size_t SharersCount() const noexcept {
+        return static_cast<size_t>(shared_.use_count());
+    }
+
+private:
+    std::shared_ptr<const SingleLinkedList<Type>> shared_;
+};
+
+template <typename Type>
+bool operator==(const ListSnapshot<Type>& lhs, const ListSnapshot<Type>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize()) {
+        return false;
+    }
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type>
+bool operator!=(const ListSnapshot<Type>& lhs, const ListSnapshot<Type>& rhs) {
+    return !(lhs == rhs);
+}
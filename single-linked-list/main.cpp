@@ -1,6 +1,1582 @@
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
+#include "arena-allocator.h"
+#include "chunked-linked-list.h"
+#include "concurrent-single-linked-list.h"
+#include "frozen-single-linked-list.h"
+#include "inline-pool-allocator.h"
+#include "list-snapshot.h"
 #include "single-linked-list.h"
+#include "static-single-linked-list.h"
+
+// Аллокатор, подсчитывающий выделения и освобождения памяти
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator(int& allocations, int& deallocations) noexcept
+        : allocations_ptr(&allocations)
+        , deallocations_ptr(&deallocations) {
+    }
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other) noexcept
+        : allocations_ptr(other.allocations_ptr)
+        , deallocations_ptr(other.deallocations_ptr) {
+    }
+
+    T* allocate(size_t n) {
+        ++(*allocations_ptr);
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T* ptr, size_t) noexcept {
+        ++(*deallocations_ptr);
+        ::operator delete(ptr);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>& rhs) const noexcept {
+        return allocations_ptr == rhs.allocations_ptr;
+    }
+    template <typename U>
+    bool operator!=(const CountingAllocator<U>& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+    int* allocations_ptr = nullptr;
+    int* deallocations_ptr = nullptr;
+};
+
+void TestAllocatorAwareness() {
+    // Все узлы выделяются и освобождаются через пользовательский аллокатор
+    {
+        int allocations = 0;
+        int deallocations = 0;
+        {
+            CountingAllocator<int> alloc(allocations, deallocations);
+            SingleLinkedList<int, CountingAllocator<int>> list(alloc);
+            list.PushFront(1);
+            list.InsertAfter(list.cbegin(), 2);
+            assert(allocations == 2);
+            list.PopFront();
+            assert(deallocations == 1);
+            assert((list == SingleLinkedList<int, CountingAllocator<int>>({2}, alloc)));
+        }
+        assert(allocations > 0);
+        assert(allocations == deallocations);
+    }
+
+    // Копирование и swap сохраняют работоспособность с аллокатором
+    {
+        int allocations = 0;
+        int deallocations = 0;
+        CountingAllocator<int> alloc(allocations, deallocations);
+        SingleLinkedList<int, CountingAllocator<int>> source({1, 2, 3}, alloc);
+        SingleLinkedList<int, CountingAllocator<int>> copy(source);
+        assert(copy == source);
+        copy.PushFront(0);
+        copy.swap(source);
+        assert(copy.GetSize() == 3u);
+        assert(source.GetSize() == 4u);
+    }
+
+    // Список со стандартным аллокатором продолжает работать как раньше
+    {
+        SingleLinkedList<int> list{1, 2, 3};
+        assert(list.GetSize() == 3u);
+        assert(list.get_allocator() == std::allocator<int>());
+    }
+}
+
+void TestMoveSemantics() {
+    // Вспомогательный тип, подсчитывающий копирования
+    struct CopySpy {
+        CopySpy() = default;
+        explicit CopySpy(int& copy_counter) noexcept
+            : copy_counter_ptr(&copy_counter) {
+        }
+        CopySpy(const CopySpy& other)
+            : copy_counter_ptr(other.copy_counter_ptr) {
+            if (copy_counter_ptr) {
+                ++(*copy_counter_ptr);
+            }
+        }
+        CopySpy(CopySpy&& other) noexcept
+            : copy_counter_ptr(other.copy_counter_ptr) {
+            other.copy_counter_ptr = nullptr;
+        }
+        CopySpy& operator=(const CopySpy&) = delete;
+        int* copy_counter_ptr = nullptr;
+    };
+
+    // Конструктор перемещения: O(1), источник остаётся пустым
+    {
+        SingleLinkedList<int> source{1, 2, 3};
+        SingleLinkedList<int> destination(std::move(source));
+        assert((destination == SingleLinkedList<int>{1, 2, 3}));
+        assert(source.IsEmpty());
+    }
+
+    // Перемещающее присваивание
+    {
+        SingleLinkedList<int> source{1, 2, 3};
+        SingleLinkedList<int> destination{9, 8};
+        destination = std::move(source);
+        assert((destination == SingleLinkedList<int>{1, 2, 3}));
+        assert(source.IsEmpty());
+    }
+
+    // PushFront и InsertAfter от rvalue не копируют элемент
+    {
+        int copies = 0;
+        SingleLinkedList<CopySpy> list;
+        list.PushFront(CopySpy(copies));
+        list.InsertAfter(list.cbegin(), CopySpy(copies));
+        assert(copies == 0);
+        assert(list.GetSize() == 2u);
+    }
+}
+
+void TestEmplace() {
+    // Тип без копирования и перемещения: создать его в списке можно
+    // только конструированием на месте
+    struct PinnedPair {
+        PinnedPair() = default;
+        PinnedPair(int first, std::string second)
+            : first(first)
+            , second(std::move(second)) {
+        }
+        PinnedPair(const PinnedPair&) = delete;
+        PinnedPair& operator=(const PinnedPair&) = delete;
+        int first = 0;
+        std::string second;
+    };
+
+    {
+        SingleLinkedList<PinnedPair> list;
+        auto& front = list.EmplaceFront(1, "one");
+        assert(front.first == 1);
+        assert(front.second == "one");
+
+        auto it = list.EmplaceAfter(list.cbegin(), 2, "two");
+        assert(it->first == 2);
+        assert(it->second == "two");
+        assert(list.GetSize() == 2u);
+    }
+
+    // EmplaceFront возвращает ссылку на созданный элемент
+    {
+        SingleLinkedList<std::string> list;
+        list.EmplaceFront(5, '*') += "!";
+        assert(*list.begin() == "*****!");
+    }
+}
+
+void TestArenaClear() {
+    // Clear() со стандартным аллокатором по-прежнему обходит цепочку
+    {
+        SingleLinkedList<int> list{1, 2, 3};
+        list.Clear();
+        assert(list.IsEmpty());
+        assert(list.GetSize() == 0u);
+    }
+
+    // Монопольный владелец арены сбрасывает её за O(1) явным
+    // ClearAndReleaseAll(); обычный Clear() арену не трогает
+    {
+        MonotonicArena arena;
+        SingleLinkedList<int, ArenaAllocator<int>> list{ArenaAllocator<int>(arena)};
+        for (int i = 0; i < 1000; ++i) {
+            list.PushFront(i);
+        }
+        assert(list.GetSize() == 1000u);
+        list.ClearAndReleaseAll();
+        assert(list.IsEmpty());
+        // Арена снова пригодна для наполнения
+        list.PushFront(42);
+        assert(*list.begin() == 42);
+    }
+
+    // Внутренние временные списки (конструктор от initializer_list,
+    // копирование, присваивание) разделяют арену с живым списком
+    // и не должны сбрасывать её своими деструкторами
+    {
+        MonotonicArena arena;
+        ArenaAllocator<int> alloc(arena);
+        SingleLinkedList<int, ArenaAllocator<int>> list({1, 2, 3}, alloc);
+        int sum = 0;
+        for (int value : list) {
+            sum += value;
+        }
+        assert(sum == 6);
+
+        SingleLinkedList<int, ArenaAllocator<int>> other({7, 8}, alloc);
+        other = list;
+        assert(other == list);
+        assert(*list.begin() == 1);
+        list.Clear();
+        // Узлы other переживают очистку соседа по арене
+        assert((other == SingleLinkedList<int, ArenaAllocator<int>>({1, 2, 3}, alloc)));
+    }
+
+    // Нетривиальный тип на арене: Clear() обязан вызвать деструкторы
+    {
+        struct DestructionCounter {
+            ~DestructionCounter() {
+                if (counter_ptr) {
+                    ++(*counter_ptr);
+                }
+            }
+            int* counter_ptr = nullptr;
+        };
+
+        int destroyed = 0;
+        MonotonicArena arena;
+        SingleLinkedList<DestructionCounter, ArenaAllocator<DestructionCounter>> list{
+            ArenaAllocator<DestructionCounter>(arena)};
+        list.PushFront(DestructionCounter{});
+        list.PushFront(DestructionCounter{});
+        for (auto& item : list) {
+            item.counter_ptr = &destroyed;
+        }
+        list.Clear();
+        assert(destroyed == 2);
+    }
+}
+
+void TestInlinePool() {
+    constexpr size_t kPoolBytes = 128;
+    using Pool = InlinePool<kPoolBytes>;
+    using Alloc = InlinePoolAllocator<int, kPoolBytes>;
+
+    // Короткий список целиком живёт во встроенном буфере рядом с пулом
+    {
+        Pool pool;
+        SingleLinkedList<int, Alloc> list{Alloc(pool)};
+        list.PushFront(3);
+        list.PushFront(2);
+        list.PushFront(1);
+        const std::vector<int> expected{1, 2, 3};
+        assert(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            // Адрес значения совпадает с адресом узла: value — первое поле
+            assert(pool.Owns(&*it));
+        }
+    }
+
+    // Переполнение буфера прозрачно уходит в кучу, интерфейс не меняется
+    {
+        Pool pool;
+        SingleLinkedList<int, Alloc> list{Alloc(pool)};
+        const int count = 50;
+        for (int i = count; i > 0; --i) {
+            list.PushFront(i);
+        }
+        assert(list.GetSize() == static_cast<size_t>(count));
+        size_t inline_nodes = 0;
+        int expected = 1;
+        for (auto it = list.begin(); it != list.end(); ++it, ++expected) {
+            assert(*it == expected);
+            if (pool.Owns(&*it)) {
+                ++inline_nodes;
+            }
+        }
+        // Часть узлов поместилась в пул, остальные — в куче
+        assert(inline_nodes > 0);
+        assert(inline_nodes < static_cast<size_t>(count));
+    }
+
+    // Освобождённые слоты переиспользуются: после очистки короткий
+    // список снова размещается во встроенном буфере
+    {
+        Pool pool;
+        SingleLinkedList<int, Alloc> list{Alloc(pool)};
+        for (int i = 0; i < 40; ++i) {
+            list.PushFront(i);
+        }
+        list.Clear();
+        list.PushFront(7);
+        list.PushFront(8);
+        assert(pool.Owns(&*list.begin()));
+        const std::vector<int> expected{8, 7};
+        assert(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    }
+}
+
+void TestInsertSorted() {
+    // Вставки в произвольном порядке выстраивают отсортированный список
+    {
+        SingleLinkedList<int> list;
+        for (int value : {5, 1, 4, 2, 3, 0, 6}) {
+            auto it = list.InsertSorted(value);
+            assert(*it == value);
+        }
+        assert((list == SingleLinkedList<int>{0, 1, 2, 3, 4, 5, 6}));
+
+        // Хвост актуален: вставка максимума идёт в конец
+        list.PushBack(100);
+        assert(*list.IteratorAt(list.GetSize() - 1) == 100);
+    }
+
+    // Подсказка от предыдущей вставки: почти отсортированный поток
+    // обходится короткими досканированиями
+    {
+        SingleLinkedList<int> list;
+        auto hint = list.cbefore_begin();
+        for (int i = 0; i < 1000; ++i) {
+            // Поток возрастает с лёгкими перестановками соседей
+            const int value = i + (i % 3 == 0 ? 1 : 0) - (i % 7 == 0 ? 1 : 0);
+            hint = list.InsertSorted(hint, value);
+        }
+        assert(list.GetSize() == 1000u);
+        assert(std::is_sorted(list.begin(), list.end()));
+    }
+
+    // Непригодная подсказка откатывается к началу списка
+    {
+        SingleLinkedList<int> list{10, 20, 30};
+        auto hint = list.IteratorAt(2);
+        auto it = list.InsertSorted(hint, 15);
+        assert(*it == 15);
+        assert((list == SingleLinkedList<int>{10, 15, 20, 30}));
+    }
+
+    // Пользовательский компаратор и равные ключи: новые элементы
+    // встают после имеющихся — порядок поступления сохраняется
+    {
+        using Entry = std::pair<int, char>;
+        const auto by_key = [](const Entry& lhs, const Entry& rhs) {
+            return lhs.first < rhs.first;
+        };
+        SingleLinkedList<Entry> list;
+        list.InsertSorted(Entry{1, 'a'}, by_key);
+        list.InsertSorted(Entry{2, 'b'}, by_key);
+        list.InsertSorted(Entry{1, 'c'}, by_key);
+        list.InsertSorted(Entry{2, 'd'}, by_key);
+        assert((list == SingleLinkedList<Entry>{{1, 'a'}, {1, 'c'}, {2, 'b'}, {2, 'd'}}));
+    }
+
+    // Убывающий порядок через std::greater
+    {
+        SingleLinkedList<int> list;
+        for (int value : {3, 1, 4, 1, 5}) {
+            list.InsertSorted(value, std::greater<int>());
+        }
+        assert((list == SingleLinkedList<int>{5, 4, 3, 1, 1}));
+    }
+}
+
+void TestSort() {
+    // Пустой и одноэлементный списки сортировка не трогает
+    {
+        SingleLinkedList<int> empty_list;
+        empty_list.Sort();
+        assert(empty_list.IsEmpty());
+
+        SingleLinkedList<int> single{42};
+        single.Sort();
+        assert((single == SingleLinkedList<int>{42}));
+    }
+
+    // Сортировка по возрастанию и с пользовательским компаратором
+    {
+        SingleLinkedList<int> list{5, 3, 1, 4, 2, 9, 7, 8, 6, 0};
+        list.Sort();
+        assert((list == SingleLinkedList<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+        list.Sort(std::greater<int>());
+        assert((list == SingleLinkedList<int>{9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+
+        // Хвост актуален после пересборки цепочки
+        list.PushBack(-1);
+        assert(list.GetSize() == 11u);
+        auto it = list.begin();
+        for (size_t i = 0; i + 1 < list.GetSize(); ++i) {
+            ++it;
+        }
+        assert(*it == -1);
+    }
+
+    // Устойчивость: равные ключи сохраняют исходный взаимный порядок
+    {
+        using Entry = std::pair<int, char>;
+        SingleLinkedList<Entry> list{{2, 'a'}, {1, 'b'}, {2, 'c'}, {1, 'd'}};
+        list.Sort([](const Entry& lhs, const Entry& rhs) {
+            return lhs.first < rhs.first;
+        });
+        assert((list == SingleLinkedList<Entry>{{1, 'b'}, {1, 'd'}, {2, 'a'}, {2, 'c'}}));
+    }
+}
+
+void TestSkipIndex() {
+    using List = SingleLinkedList<int>;
+
+    // Размер больше двух шагов индекса, чтобы задействовать несколько опорных узлов
+    const size_t count = List::kSkipIndexStride * 2 + 400;
+    List list;
+    for (size_t i = count; i > 0; --i) {
+        list.PushFront(static_cast<int>(i - 1));
+    }
+
+    // IteratorAt: начало, середина и конец, включая границы шага индекса
+    {
+        assert(*list.IteratorAt(0) == 0);
+        assert(*list.IteratorAt(List::kSkipIndexStride - 1)
+               == static_cast<int>(List::kSkipIndexStride - 1));
+        assert(*list.IteratorAt(List::kSkipIndexStride)
+               == static_cast<int>(List::kSkipIndexStride));
+        assert(*list.IteratorAt(count - 1) == static_cast<int>(count - 1));
+    }
+
+    // AdvanceFast: короткий сдвиг идёт по ссылкам, длинный — через индекс
+    {
+        const List& const_list = list;
+        auto it = const_list.cbegin();
+        auto near_it = list.AdvanceFast(it, 0, 5);
+        assert(*near_it == 5);
+        auto far_it = list.AdvanceFast(near_it, 5, List::kSkipIndexStride + 100);
+        assert(*far_it == static_cast<int>(List::kSkipIndexStride + 105));
+    }
+
+    // Модификация структуры сбрасывает индекс: позиции остаются верными
+    {
+        list.PopFront();
+        assert(*list.IteratorAt(0) == 1);
+        assert(*list.IteratorAt(List::kSkipIndexStride) == static_cast<int>(List::kSkipIndexStride + 1));
+
+        list.PushFront(-7);
+        assert(*list.IteratorAt(0) == -7);
+        assert(*list.IteratorAt(count - 1) == static_cast<int>(count - 1));
+
+        auto it = list.IteratorAt(1);
+        list.InsertAfter(it, 100500);
+        assert(*list.IteratorAt(2) == 100500);
+        assert(*list.IteratorAt(3) == 2);
+    }
+
+    // Перестройка цепочки (Sort/Reverse) также инвалидирует индекс
+    {
+        SingleLinkedList<int> small{3, 1, 2};
+        assert(*small.IteratorAt(1) == 1);
+        small.Sort();
+        assert(*small.IteratorAt(1) == 2);
+        small.Reverse();
+        assert(*small.IteratorAt(0) == 3);
+    }
+}
+
+void TestParallelSort() {
+    // Результат совпадает с последовательной сортировкой
+    {
+        SingleLinkedList<int> parallel_list;
+        SingleLinkedList<int> sequential_list;
+        // Детерминированный псевдослучайный порядок
+        unsigned int seed = 12345;
+        for (int i = 0; i < 10000; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const int value = static_cast<int>(seed % 1000u);
+            parallel_list.PushFront(value);
+            sequential_list.PushFront(value);
+        }
+        parallel_list.ParallelSort(4);
+        sequential_list.Sort();
+        assert(parallel_list == sequential_list);
+        assert(std::is_sorted(parallel_list.begin(), parallel_list.end()));
+
+        // Хвост актуален после пересборки цепочки
+        parallel_list.PushBack(100500);
+        assert(*parallel_list.IteratorAt(parallel_list.GetSize() - 1) == 100500);
+    }
+
+    // Пользовательский компаратор и вырожденные случаи
+    {
+        SingleLinkedList<int> list{3, 1, 4, 1, 5, 9, 2, 6};
+        list.ParallelSort(std::greater<int>(), 3);
+        assert((list == SingleLinkedList<int>{9, 6, 5, 4, 3, 2, 1, 1}));
+
+        SingleLinkedList<int> single{7};
+        single.ParallelSort();
+        assert((single == SingleLinkedList<int>{7}));
+
+        SingleLinkedList<int> empty_list;
+        empty_list.ParallelSort();
+        assert(empty_list.IsEmpty());
+
+        // parallelism <= 1 откатывается к последовательной сортировке
+        SingleLinkedList<int> fallback{2, 1, 3};
+        fallback.ParallelSort(1);
+        assert((fallback == SingleLinkedList<int>{1, 2, 3}));
+    }
+
+    // Устойчивость сохраняется и при параллельном слиянии сегментов
+    {
+        using Entry = std::pair<int, int>;
+        SingleLinkedList<Entry> list;
+        for (int i = 99; i >= 0; --i) {
+            list.PushFront({i % 3, i});
+        }
+        list.ParallelSort([](const Entry& lhs, const Entry& rhs) {
+            return lhs.first < rhs.first;
+        }, 4);
+        // При равных ключах исходный взаимный порядок (по второму полю)
+        auto it = list.begin();
+        Entry previous = *it;
+        for (++it; it != list.end(); ++it) {
+            assert(previous.first <= it->first);
+            if (previous.first == it->first) {
+                assert(previous.second < it->second);
+            }
+            previous = *it;
+        }
+    }
+}
+
+void TestReverseAndMerge() {
+    // Reverse: один проход, крайние случаи не ломают инварианты
+    {
+        SingleLinkedList<int> list{1, 2, 3, 4};
+        list.Reverse();
+        assert((list == SingleLinkedList<int>{4, 3, 2, 1}));
+        list.PushBack(0);
+        assert((list == SingleLinkedList<int>{4, 3, 2, 1, 0}));
+
+        SingleLinkedList<int> empty_list;
+        empty_list.Reverse();
+        assert(empty_list.IsEmpty());
+
+        SingleLinkedList<int> single{5};
+        single.Reverse();
+        assert((single == SingleLinkedList<int>{5}));
+    }
+
+    // Merge двух отсортированных списков: other пустеет, порядок общий
+    {
+        SingleLinkedList<int> destination{1, 3, 5, 7};
+        SingleLinkedList<int> source{2, 4, 6};
+        destination.Merge(source);
+        assert((destination == SingleLinkedList<int>{1, 2, 3, 4, 5, 6, 7}));
+        assert(destination.GetSize() == 7u);
+        assert(source.IsEmpty());
+        destination.PushBack(8);
+        assert(destination.GetSize() == 8u);
+    }
+
+    // Merge с компаратором и пустыми списками
+    {
+        SingleLinkedList<int> destination{7, 5, 1};
+        SingleLinkedList<int> source{6, 2};
+        destination.Merge(source, std::greater<int>());
+        assert((destination == SingleLinkedList<int>{7, 6, 5, 2, 1}));
+
+        SingleLinkedList<int> empty_list;
+        destination.Merge(empty_list);
+        assert(destination.GetSize() == 5u);
+    }
+}
+
+#ifdef SINGLE_LINKED_LIST_DEBUG_ITERATORS
+void TestDebugIterators() {
+    // Вставки не инвалидируют ранее выданные итераторы:
+    // у односвязного списка они не трогают существующие узлы
+    {
+        SingleLinkedList<int> list{1, 2, 3};
+        auto it = list.begin();
+        list.PushFront(0);
+        list.InsertAfter(it, 10);
+        assert(*it == 1);
+        ++it;
+        assert(*it == 10);
+    }
+
+    // Удаление объявляет старые итераторы недействительными;
+    // итератор из EraseAfter проштампован уже новым поколением
+    {
+        SingleLinkedList<int> list{1, 2, 3};
+        auto it = list.EraseAfter(list.begin());
+        assert(*it == 3);
+        auto fresh = list.begin();
+        assert(*fresh == 1);
+        ++fresh;
+        assert(*fresh == 3);
+    }
+
+    // Копия и конверсия в ConstIterator переносят штамп
+    {
+        SingleLinkedList<int> list{5, 6};
+        SingleLinkedList<int>::ConstIterator const_it = list.begin();
+        auto copy_it = const_it;
+        assert(*const_it == 5);
+        assert(*copy_it == 5);
+    }
+}
+#endif
+
+#ifdef SINGLE_LINKED_LIST_STATS
+void TestStats() {
+    // Счётчики аллокаций, освобождений и пикового размера
+    {
+        SingleLinkedList<int> list;
+        list.PushFront(1);
+        list.PushBack(2);
+        list.PushBack(3);
+        assert(list.Stats().allocations == 3u);
+        assert(list.Stats().peak_size == 3u);
+        list.PopFront();
+        assert(list.Stats().deallocations == 1u);
+        list.Clear();
+        assert(list.Stats().deallocations == 3u);
+        // Пиковый размер не уменьшается при удалениях
+        assert(list.Stats().peak_size == 3u);
+    }
+
+    // Внутренние проходы по узлам учитываются
+    {
+        SingleLinkedList<int> list{3, 1, 2, 4};
+        const size_t before_sort = list.Stats().nodes_traversed;
+        list.Sort();
+        assert(list.Stats().nodes_traversed > before_sort);
+
+        const size_t before_reverse = list.Stats().nodes_traversed;
+        list.Reverse();
+        assert(list.Stats().nodes_traversed == before_reverse + 4u);
+    }
+}
+#endif
+
+void TestRemoveIfAndUnique() {
+    // RemoveIf удаляет все подходящие элементы и возвращает их число
+    {
+        SingleLinkedList<int> list{1, 2, 3, 4, 5, 6};
+        const size_t removed = list.RemoveIf([](int value) {
+            return value % 2 == 0;
+        });
+        assert(removed == 3u);
+        assert((list == SingleLinkedList<int>{1, 3, 5}));
+        assert(list.GetSize() == 3u);
+        list.PushBack(7);
+        assert((list == SingleLinkedList<int>{1, 3, 5, 7}));
+    }
+
+    // Удаление всех элементов и отсутствие совпадений
+    {
+        SingleLinkedList<int> list{1, 2, 3};
+        assert(list.RemoveIf([](int) { return true; }) == 3u);
+        assert(list.IsEmpty());
+        list.PushBack(1);
+        assert(list.RemoveIf([](int) { return false; }) == 0u);
+        assert((list == SingleLinkedList<int>{1}));
+    }
+
+    // Unique схлопывает подряд идущие дубликаты
+    {
+        SingleLinkedList<int> list{1, 1, 2, 2, 2, 3, 1, 1};
+        const size_t removed = list.Unique();
+        assert(removed == 4u);
+        assert((list == SingleLinkedList<int>{1, 2, 3, 1}));
+        list.PushBack(1);
+        assert((list == SingleLinkedList<int>{1, 2, 3, 1, 1}));
+    }
+
+    // Unique с бинарным предикатом
+    {
+        SingleLinkedList<int> list{1, 2, 12, 23, 3, 45};
+        list.Unique([](int lhs, int rhs) {
+            return lhs % 10 == rhs % 10;
+        });
+        assert((list == SingleLinkedList<int>{1, 2, 23, 45}));
+    }
+}
+
+void TestSerialization() {
+    // Круговой обход через поток восстанавливает содержимое и инварианты
+    {
+        SingleLinkedList<int> source{1, 2, 3, 4, 5};
+        std::stringstream stream;
+        source.Serialize(stream);
+
+        auto restored = SingleLinkedList<int>::Deserialize(stream);
+        assert(restored == source);
+        restored.PushBack(6);
+        assert(restored.GetSize() == 6u);
+    }
+
+    // Пустой список сериализуется и восстанавливается корректно
+    {
+        SingleLinkedList<int> empty_list;
+        std::stringstream stream;
+        empty_list.Serialize(stream);
+        const auto restored = SingleLinkedList<int>::Deserialize(stream);
+        assert(restored.IsEmpty());
+    }
+
+    // Перегрузка от буфера разбирает те же байты без потока
+    {
+        SingleLinkedList<double> source{1.5, -2.25, 3.75};
+        std::stringstream stream;
+        source.Serialize(stream);
+        const std::string bytes = stream.str();
+
+        const auto restored = SingleLinkedList<double>::Deserialize(bytes.data(), bytes.size());
+        assert(restored == source);
+    }
+
+    // Усечённый буфер приводит к исключению, а не чтению мусора
+    {
+        SingleLinkedList<int> source{1, 2, 3};
+        std::stringstream stream;
+        source.Serialize(stream);
+        const std::string bytes = stream.str();
+
+        bool exception_was_thrown = false;
+        try {
+            SingleLinkedList<int>::Deserialize(bytes.data(), bytes.size() - 1);
+        } catch (const std::runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+    }
+
+    // Враждебный префикс: count, переполняющий count * sizeof(Type),
+    // не должен проходить проверку длины
+    {
+        unsigned char bytes[16] = {};
+        const uint64_t hostile_count = uint64_t{1} << 62;
+        std::memcpy(bytes, &hostile_count, sizeof(hostile_count));
+
+        bool exception_was_thrown = false;
+        try {
+            SingleLinkedList<int>::Deserialize(bytes, sizeof(bytes));
+        } catch (const std::runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+    }
+}
+
+void TestFrozenList() {
+    // Freeze переносит элементы в непрерывный буфер, Thaw возвращает
+    // обычный список с тем же содержимым
+    {
+        SingleLinkedList<int> source{1, 2, 3, 4};
+        const auto frozen = FrozenSingleLinkedList<int>::Freeze(source);
+        assert(frozen.GetSize() == 4u);
+        assert(std::equal(frozen.begin(), frozen.end(), source.begin()));
+
+        const auto thawed = frozen.Thaw();
+        assert(thawed == source);
+    }
+
+    // Невладеющее представление поверх байтов формата Serialize
+    {
+        SingleLinkedList<int> source{10, 20, 30};
+        std::stringstream stream;
+        source.Serialize(stream);
+        const std::string bytes = stream.str();
+
+        const auto view = FrozenSingleLinkedList<int>::View(bytes.data(), bytes.size());
+        assert(view.GetSize() == 3u);
+        int expected = 10;
+        for (int value : view) {
+            assert(value == expected);
+            expected += 10;
+        }
+    }
+
+    // Копирование и перемещение сохраняют корректность буфера
+    {
+        SingleLinkedList<std::string> source{"a", "b"};
+        const auto frozen = FrozenSingleLinkedList<std::string>::Freeze(source);
+        const auto copy = frozen;
+        assert(copy == frozen);
+
+        auto moved = copy;
+        const FrozenSingleLinkedList<std::string> stolen(std::move(moved));
+        assert(stolen == frozen);
+        assert(moved.IsEmpty());
+    }
+
+    // Пустые списки
+    {
+        SingleLinkedList<int> empty_source;
+        const auto frozen = FrozenSingleLinkedList<int>::Freeze(empty_source);
+        assert(frozen.IsEmpty());
+        assert(frozen.begin() == frozen.end());
+        assert(frozen.Thaw().IsEmpty());
+    }
+
+    // Враждебный префикс: count, переполняющий count * sizeof(Type),
+    // не должен проходить проверку длины View
+    {
+        unsigned char bytes[16] = {};
+        const uint64_t hostile_count = uint64_t{1} << 62;
+        std::memcpy(bytes, &hostile_count, sizeof(hostile_count));
+
+        bool exception_was_thrown = false;
+        try {
+            FrozenSingleLinkedList<int>::View(bytes, sizeof(bytes));
+        } catch (const std::runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+    }
+}
+
+// Таблица собирается на этапе компиляции: цикл исполняет компилятор
+constexpr StaticSingleLinkedList<int, 8> MakeStaticTable() {
+    StaticSingleLinkedList<int, 8> list;
+    list.PushFront(30);
+    list.PushFront(20);
+    list.PushFront(10);
+    list.InsertAfter(list.cbegin(), 15);
+    return list;
+}
+
+void TestPrefetchIteration() {
+    // Потоковый итератор обходит те же элементы в том же порядке
+    {
+        SingleLinkedList<int> list;
+        const int count = 1000;
+        for (int i = count; i > 0; --i) {
+            list.PushFront(i);
+        }
+        int expected = 1;
+        for (auto it = list.prefetch_begin(); it != list.prefetch_end(); ++it, ++expected) {
+            assert(*it == expected);
+        }
+        assert(expected == count + 1);
+    }
+
+    // Списки короче дистанции предвыборки и пустой список
+    {
+        SingleLinkedList<int> short_list{1, 2, 3};
+        int sum = 0;
+        for (auto it = short_list.prefetch_begin(); it != short_list.prefetch_end(); ++it) {
+            sum += *it;
+        }
+        assert(sum == 6);
+
+        SingleLinkedList<int> empty_list;
+        assert(empty_list.prefetch_begin() == empty_list.prefetch_end());
+    }
+
+    // Константный обход и доступ через operator->
+    {
+        const SingleLinkedList<std::string> list{std::string("alpha"), std::string("beta")};
+        auto it = list.prefetch_begin();
+        assert(it->size() == 5u);
+        ++it;
+        assert(*it == "beta");
+        ++it;
+        assert(it == list.prefetch_end());
+    }
+}
+
+void TestStaticList() {
+    // Проверки на этапе компиляции: размер, порядок, образ, сравнения
+    {
+        constexpr auto table = MakeStaticTable();
+        static_assert(table.GetSize() == 4);
+        static_assert(*table.begin() == 10);
+
+        constexpr auto image = table.ToImage();
+        static_assert(image.size == 4);
+        static_assert(image.values[0] == 10);
+        static_assert(image.values[1] == 15);
+        static_assert(image.values[2] == 20);
+        static_assert(image.values[3] == 30);
+
+        static_assert(table == MakeStaticTable());
+        constexpr StaticSingleLinkedList<int, 4> empty_table{};
+        static_assert(table != empty_table);
+        static_assert(empty_table < table);
+        static_assert(empty_table.IsEmpty());
+
+        // Инкремент before_begin() ведёт к первому элементу и у пустого,
+        // и у заполненного списка — как у остальных списков репозитория
+        static_assert(++table.before_begin() == table.begin());
+        static_assert(++empty_table.before_begin() == empty_table.begin());
+    }
+
+    // Те же операции работают и в рантайме, итераторы совместимы
+    // с алгоритмами стандартной библиотеки
+    {
+        StaticSingleLinkedList<int, 16> list;
+        for (int i = 5; i > 0; --i) {
+            list.PushFront(i);
+        }
+        assert(list.GetSize() == 5u);
+        const std::vector<int> expected{1, 2, 3, 4, 5};
+        assert(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+
+        auto it = list.InsertAfter(list.before_begin(), 0);
+        assert(*it == 0);
+        assert(*list.begin() == 0);
+        assert(++list.before_begin() == list.begin());
+
+        // Образ повторяет порядок обхода
+        const auto image = list.ToImage();
+        assert(image.size == 6u);
+        assert(std::equal(image.begin(), image.end(), list.begin()));
+    }
+}
+
+void TestDenseView() {
+    // Плотное представление повторяет порядок обхода списка
+    {
+        SingleLinkedList<int> list{3, 1, 4, 1, 5};
+        const std::vector<int>& dense = list.ToDenseView();
+        assert((dense == std::vector<int>{3, 1, 4, 1, 5}));
+        // Повторный вызов без изменений возвращает тот же буфер
+        assert(&list.ToDenseView() == &dense);
+    }
+
+    // Sum и MinMax считаются по плотной копии
+    {
+        SingleLinkedList<int> list{7, -2, 9, 0, 4};
+        assert(list.Sum() == 18);
+        auto [lowest, highest] = list.MinMax();
+        assert(lowest == -2);
+        assert(highest == 9);
+    }
+
+    // Структурное изменение сбрасывает копию: агрегаты пересчитываются
+    {
+        SingleLinkedList<int> list{1, 2, 3};
+        assert(list.Sum() == 6);
+        list.PushFront(10);
+        assert(list.Sum() == 16);
+        list.PopFront();
+        list.Sort(std::greater<int>());
+        assert((list.ToDenseView() == std::vector<int>{3, 2, 1}));
+    }
+
+    // У замороженного списка агрегаты идут прямо по его буферу
+    {
+        SingleLinkedList<int> source{5, 8, -1, 6};
+        auto frozen = FrozenSingleLinkedList<int>::Freeze(source);
+        assert(frozen.Data() != nullptr);
+        assert(frozen.Sum() == 18);
+        auto [lowest, highest] = frozen.MinMax();
+        assert(lowest == -1);
+        assert(highest == 8);
+    }
+}
+
+void TestSnapshotSharing() {
+    // Один снимок, много потребителей: копия цепочки делается один раз,
+    // раздача дескрипторов лишь наращивает счётчик ссылок
+    {
+        SingleLinkedList<int> source{1, 2, 3, 4};
+        auto snapshot = ListSnapshot<int>::Take(source);
+        assert(snapshot.SharersCount() == 1u);
+
+        std::vector<ListSnapshot<int>> consumers(10, snapshot);
+        assert(snapshot.SharersCount() == 11u);
+        for (const auto& consumer : consumers) {
+            assert(consumer.GetSize() == 4u);
+            assert(std::equal(consumer.begin(), consumer.end(), source.begin()));
+        }
+    }
+
+    // Снимок не зависит от дальнейшей судьбы источника
+    {
+        SingleLinkedList<int> source{7, 8};
+        auto snapshot = ListSnapshot<int>::Take(source);
+        source.PushFront(0);
+        source.Clear();
+        assert(snapshot.GetSize() == 2u);
+        assert(*snapshot.begin() == 7);
+    }
+
+    // Fork: узлы копируются только для мутирующего потребителя
+    {
+        auto snapshot = ListSnapshot<int>::Take(SingleLinkedList<int>{1, 2, 3});
+        auto reader = snapshot;
+        auto writable = snapshot.Fork();
+        writable.PushFront(0);
+        assert((writable == SingleLinkedList<int>{0, 1, 2, 3}));
+        // Читатели видят прежнее содержимое
+        assert(reader.GetSize() == 3u);
+        assert(*reader.begin() == 1);
+        assert(snapshot == reader);
+    }
+
+    // Пустой дескриптор ведёт себя как пустой список
+    {
+        ListSnapshot<int> empty_snapshot;
+        assert(empty_snapshot.IsEmpty());
+        assert(empty_snapshot.begin() == empty_snapshot.end());
+        assert(empty_snapshot.Fork().IsEmpty());
+    }
+}
+
+void TestConcurrentList() {
+    // Однопоточное поведение: LIFO-порядок, StealAll опустошает список
+    {
+        ConcurrentSingleLinkedList<int> list;
+        assert(list.IsEmpty());
+        list.PushFront(1);
+        list.PushFront(2);
+        list.EmplaceFront(3);
+
+        auto chain = list.StealAll();
+        assert(list.IsEmpty());
+        int expected = 3;
+        for (int value : chain) {
+            assert(value == expected);
+            --expected;
+        }
+        assert(expected == 0);
+    }
+
+    // Несколько производителей толкают элементы одновременно:
+    // ни один не теряется и не дублируется
+    {
+        constexpr int kThreads = 4;
+        constexpr int kPerThread = 10000;
+
+        ConcurrentSingleLinkedList<int> list;
+        std::vector<std::thread> producers;
+        for (int t = 0; t < kThreads; ++t) {
+            producers.emplace_back([&list, t] {
+                for (int i = 0; i < kPerThread; ++i) {
+                    list.PushFront(t * kPerThread + i);
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+
+        auto chain = list.StealAll();
+        std::vector<bool> seen(kThreads * kPerThread, false);
+        size_t count = 0;
+        for (int value : chain) {
+            assert(!seen[static_cast<size_t>(value)]);
+            seen[static_cast<size_t>(value)] = true;
+            ++count;
+        }
+        assert(count == static_cast<size_t>(kThreads * kPerThread));
+    }
+
+    // Потребитель крадёт цепочки, пока производитель работает
+    {
+        ConcurrentSingleLinkedList<int> list;
+        constexpr int kTotal = 10000;
+        std::thread producer([&list] {
+            for (int i = 0; i < kTotal; ++i) {
+                list.PushFront(i);
+            }
+        });
+
+        long long sum = 0;
+        size_t count = 0;
+        while (count < kTotal) {
+            auto chain = list.StealAll();
+            for (int value : chain) {
+                sum += value;
+                ++count;
+            }
+        }
+        producer.join();
+        assert(count == kTotal);
+        assert(sum == static_cast<long long>(kTotal) * (kTotal - 1) / 2);
+    }
+}
+
+void TestConcurrentReclamation() {
+    // PopFront в один поток: значения в LIFO-порядке, пустой список — nullopt
+    {
+        ConcurrentSingleLinkedList<int> list;
+        list.PushFront(1);
+        list.PushFront(2);
+        assert(list.PopFront() == std::optional<int>(2));
+        assert(list.PopFront() == std::optional<int>(1));
+        assert(!list.PopFront().has_value());
+    }
+
+    // Пока жив ReadGuard, изъятые узлы лишь откладываются;
+    // после выхода читателя TryReclaim освобождает их
+    {
+        ConcurrentSingleLinkedList<int> list;
+        for (int i = 0; i < 10; ++i) {
+            list.PushFront(i);
+        }
+        {
+            auto guard = list.ReadLock();
+            int seen = 0;
+            for (int value : guard) {
+                static_cast<void>(value);
+                ++seen;
+            }
+            assert(seen == 10);
+            // Изымаем элементы при живом читателе — узлы уходят в отложенные
+            for (int i = 0; i < 5; ++i) {
+                assert(list.PopFront().has_value());
+            }
+        }
+        list.TryReclaim();
+        assert(list.PopFront().has_value());
+    }
+
+    // Читатели сканируют список одновременно с изъятием и вставкой
+    {
+        ConcurrentSingleLinkedList<int> list;
+        for (int i = 0; i < 1000; ++i) {
+            list.PushFront(i);
+        }
+
+        std::atomic<bool> stop{false};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 3; ++t) {
+            readers.emplace_back([&list, &stop] {
+                while (!stop.load()) {
+                    auto guard = list.ReadLock();
+                    long long sum = 0;
+                    for (int value : guard) {
+                        sum += value;
+                    }
+                    static_cast<void>(sum);
+                }
+            });
+        }
+
+        size_t popped = 0;
+        for (int round = 0; round < 100; ++round) {
+            list.PushFront(round);
+            if (list.PopFront().has_value()) {
+                ++popped;
+            }
+            if (list.PopFront().has_value()) {
+                ++popped;
+            }
+        }
+        stop.store(true);
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        assert(popped > 0);
+        list.TryReclaim();
+    }
+}
+
+void TestParallelAlgorithms() {
+    // ForEach с мутацией: каждый элемент обрабатывается ровно один раз
+    {
+        SingleLinkedList<int> list;
+        for (int i = 999; i >= 0; --i) {
+            list.PushFront(i);
+        }
+        list.ForEach([](int& value) {
+            value *= 2;
+        }, 4);
+        int expected = 0;
+        for (int value : list) {
+            assert(value == expected * 2);
+            ++expected;
+        }
+    }
+
+    // Константный список отдаёт функтору const Type&, а мутирующий
+    // ForEach сбрасывает производные кеши
+    {
+        SingleLinkedList<int> list{1, 2, 3};
+        assert(list.Sum() == 6);
+        list.ForEach([](int& value) {
+            value += 1;
+        }, 2);
+        // Кеш плотной копии сброшен — агрегат отражает новые значения
+        assert(list.Sum() == 9);
+
+        const SingleLinkedList<int>& const_list = list;
+        int sum = 0;
+        std::mutex sum_mutex;
+        const_list.ForEach([&sum, &sum_mutex](const int& value) {
+            std::lock_guard<std::mutex> guard(sum_mutex);
+            sum += value;
+        }, 2);
+        assert(sum == 9);
+    }
+
+    // TransformReduce: параллельная сумма совпадает с последовательной
+    {
+        SingleLinkedList<long long> list;
+        long long expected_sum = 0;
+        for (long long i = 1; i <= 5000; ++i) {
+            list.PushFront(i);
+            expected_sum += i * i;
+        }
+        const auto square = [](long long value) {
+            return value * value;
+        };
+        const auto plus = [](long long lhs, long long rhs) {
+            return lhs + rhs;
+        };
+        assert(list.TransformReduce(square, plus, 0LL, 8) == expected_sum);
+        // init участвует в свёртке ровно один раз
+        assert(list.TransformReduce(square, plus, 100LL, 8) == expected_sum + 100);
+        // Последовательный путь даёт тот же результат
+        assert(list.TransformReduce(square, plus, 0LL, 1) == expected_sum);
+    }
+
+    // Вырожденные случаи: пустой и короткий списки
+    {
+        const SingleLinkedList<int> empty_list;
+        assert(empty_list.TransformReduce([](int v) { return v; },
+                                          [](int a, int b) { return a + b; }, 0, 8) == 0);
+
+        const SingleLinkedList<int> tiny{1, 2};
+        size_t visited = 0;
+        std::mutex visited_mutex;
+        tiny.ForEach([&visited, &visited_mutex](int) {
+            std::lock_guard<std::mutex> lock(visited_mutex);
+            ++visited;
+        }, 16);
+        assert(visited == 2u);
+    }
+}
+
+void TestSpliceAfter() {
+    // Перенос целого списка за O(1): порядок сохраняется, источник пустеет
+    {
+        SingleLinkedList<int> destination{1, 5, 6};
+        SingleLinkedList<int> source{2, 3, 4};
+        destination.SpliceAfter(destination.cbegin(), source);
+        assert((destination == SingleLinkedList<int>{1, 2, 3, 4, 5, 6}));
+        assert(destination.GetSize() == 6u);
+        assert(source.IsEmpty());
+
+        // Хвост принимающего списка актуален
+        destination.PushBack(7);
+        assert((destination == SingleLinkedList<int>{1, 2, 3, 4, 5, 6, 7}));
+        // Источник снова пригоден к использованию
+        source.PushBack(8);
+        assert((source == SingleLinkedList<int>{8}));
+    }
+
+    // Перенос пустого списка — безопасная пустая операция
+    {
+        SingleLinkedList<int> destination{1};
+        SingleLinkedList<int> source;
+        destination.SpliceAfter(destination.cbefore_begin(), source);
+        assert((destination == SingleLinkedList<int>{1}));
+    }
+
+    // Перенос в хвост списка
+    {
+        SingleLinkedList<int> destination{1, 2};
+        SingleLinkedList<int> source{3, 4};
+        destination.SpliceAfter(++destination.cbegin(), source);
+        assert((destination == SingleLinkedList<int>{1, 2, 3, 4}));
+        destination.PushBack(5);
+        assert((destination == SingleLinkedList<int>{1, 2, 3, 4, 5}));
+    }
+
+    // Перенос диапазона (first, last): границы не переносятся
+    {
+        SingleLinkedList<int> destination{10, 20};
+        SingleLinkedList<int> source{1, 2, 3, 4, 5};
+        auto first = source.cbegin();
+        auto last = first;
+        for (int i = 0; i < 4; ++i) {
+            ++last;
+        }
+        // Переносим (1, 5), то есть элементы 2, 3, 4
+        destination.SpliceAfter(destination.cbegin(), source, first, last);
+        assert((destination == SingleLinkedList<int>{10, 2, 3, 4, 20}));
+        assert((source == SingleLinkedList<int>{1, 5}));
+        assert(destination.GetSize() == 5u);
+        assert(source.GetSize() == 2u);
+        source.PushBack(6);
+        assert((source == SingleLinkedList<int>{1, 5, 6}));
+    }
+}
+
+void TestComparisons() {
+    // Неравные размеры отсекаются сразу; короткий правый список
+    // больше не приводит к чтению за его концом
+    {
+        SingleLinkedList<int> longer{1, 2, 3};
+        SingleLinkedList<int> shorter{1, 2};
+        assert(longer != shorter);
+        assert(shorter != longer);
+        assert(!(longer == shorter));
+    }
+
+    // Однопроходный Compare согласован с операторами порядка
+    {
+        SingleLinkedList<int> a{1, 2};
+        SingleLinkedList<int> b{1, 2, 3};
+        SingleLinkedList<int> c{1, 5};
+        assert(a.Compare(b) < 0);
+        assert(b.Compare(a) > 0);
+        assert(a.Compare(a) == 0);
+        assert(a < b);
+        assert(b > a);
+        assert(a <= a);
+        assert(a >= a);
+        assert(b < c);
+        assert(c >= b);
+
+        SingleLinkedList<int> empty_list;
+        assert(empty_list.Compare(a) < 0);
+        assert(empty_list.Compare(empty_list) == 0);
+    }
+}
+
+void TestContentHash() {
+    // Хеш определяется содержимым и порядком элементов
+    {
+        SingleLinkedList<int> list_a{1, 2, 3};
+        SingleLinkedList<int> list_b{1, 2, 3};
+        SingleLinkedList<int> reversed{3, 2, 1};
+        assert(list_a.Hash() == list_b.Hash());
+        assert(list_a.Hash() != reversed.Hash());
+
+        SingleLinkedList<int> empty_a;
+        SingleLinkedList<int> empty_b;
+        assert(empty_a.Hash() == empty_b.Hash());
+    }
+
+    // Инкрементальное обновление PushFront/PopFront согласуется
+    // с полным ленивым пересчётом
+    {
+        SingleLinkedList<int> incremental{5, 6, 7};
+        static_cast<void>(incremental.Hash());
+        incremental.PushFront(4);
+        assert(incremental.Hash() == (SingleLinkedList<int>{4, 5, 6, 7}).Hash());
+        incremental.PopFront();
+        incremental.PopFront();
+        assert(incremental.Hash() == (SingleLinkedList<int>{6, 7}).Hash());
+    }
+
+    // Вставка в середину сбрасывает кеш; хеш остаётся верным
+    {
+        SingleLinkedList<int> list{1, 3};
+        static_cast<void>(list.Hash());
+        list.InsertAfter(list.begin(), 2);
+        SingleLinkedList<int> expected{1, 2, 3};
+        assert(list.Hash() == expected.Hash());
+        assert(list == expected);
+    }
+
+    // Запись через итератор не отслеживается кешем хеша, но равенство
+    // от этого не страдает: operator== сравнивает только сами элементы
+    {
+        SingleLinkedList<int> list_a{1};
+        SingleLinkedList<int> list_b{2};
+        static_cast<void>(list_a.Hash());
+        static_cast<void>(list_b.Hash());
+        *list_a.begin() = 2;
+        assert(list_a == list_b);
+    }
+
+    // Список как ключ unordered_map: хешер поверх Hash(), совпадения
+    // добиваются поэлементным равенством
+    {
+        struct ListHasher {
+            size_t operator()(const SingleLinkedList<int>& list) const {
+                return static_cast<size_t>(list.Hash());
+            }
+        };
+        std::unordered_map<SingleLinkedList<int>, int, ListHasher> index;
+        index[SingleLinkedList<int>{1, 2}] = 12;
+        index[SingleLinkedList<int>{3}] = 3;
+        assert(index.at(SingleLinkedList<int>{1, 2}) == 12);
+        assert(index.at(SingleLinkedList<int>{3}) == 3);
+        assert(index.find(SingleLinkedList<int>{2, 1}) == index.end());
+    }
+}
+
+void TestRangeAssign() {
+    // Конструктор от пары итераторов сохраняет порядок элементов
+    {
+        std::vector<int> source{1, 2, 3, 4, 5};
+        SingleLinkedList<int> list(source.begin(), source.end());
+        assert((list == SingleLinkedList<int>{1, 2, 3, 4, 5}));
+        assert(list.GetSize() == source.size());
+        list.PushBack(6);
+        assert((list == SingleLinkedList<int>{1, 2, 3, 4, 5, 6}));
+    }
+
+    // Assign заменяет старое содержимое и работает с пустым диапазоном
+    {
+        std::vector<int> source{7, 8};
+        SingleLinkedList<int> list{1, 2, 3};
+        list.Assign(source.begin(), source.end());
+        assert((list == SingleLinkedList<int>{7, 8}));
+
+        list.Assign(source.end(), source.end());
+        assert(list.IsEmpty());
+        list.PushBack(9);
+        assert((list == SingleLinkedList<int>{9}));
+    }
+}
+
+void TestChunkedComparisons() {
+    // Равенство не зависит от разбивки по чанкам: один список заполнен
+    // подряд, второй собран вставками в середину (чанки расщеплялись)
+    {
+        ChunkedLinkedList<int, 4> sequential{1, 2, 3, 4, 5, 6, 7, 8};
+        ChunkedLinkedList<int, 4> fragmented{1, 3, 5, 7};
+        auto pos = fragmented.cbegin();
+        fragmented.InsertAfter(pos, 2);
+        ++pos;
+        ++pos;
+        fragmented.InsertAfter(pos, 4);
+        ++pos;
+        ++pos;
+        fragmented.InsertAfter(pos, 6);
+        ++pos;
+        ++pos;
+        fragmented.InsertAfter(pos, 8);
+        assert(sequential == fragmented);
+
+        fragmented.PopFront();
+        assert(sequential != fragmented);
+    }
+
+    // Нетривиальный тип сравнивается поэлементно по тем же отрезкам
+    {
+        ChunkedLinkedList<std::string, 2> lhs{"aa", "bb", "cc"};
+        ChunkedLinkedList<std::string, 2> rhs{"aa", "bb", "cc"};
+        assert(lhs == rhs);
+        rhs.PushFront("a");
+        assert(lhs != rhs);
+    }
+
+    // Лексикографический порядок, включая префиксные списки
+    {
+        ChunkedLinkedList<int, 4> shorter{1, 2};
+        ChunkedLinkedList<int, 4> longer{1, 2, 3};
+        ChunkedLinkedList<int, 4> bigger{1, 5};
+        assert(shorter < longer);
+        assert(longer > shorter);
+        assert(shorter <= shorter);
+        assert(shorter >= shorter);
+        assert(longer < bigger);
+        assert(bigger > longer);
+    }
+}
+
+void TestPushBack() {
+    // PushBack добавляет в конец за O(1)
+    {
+        SingleLinkedList<int> list;
+        list.PushBack(1);
+        list.PushBack(2);
+        list.PushBack(3);
+        assert((list == SingleLinkedList<int>{1, 2, 3}));
+
+        list.PushFront(0);
+        list.PushBack(4);
+        assert((list == SingleLinkedList<int>{0, 1, 2, 3, 4}));
+    }
+
+    // Хвост корректно сопровождается при удалениях, swap и перемещении
+    {
+        SingleLinkedList<int> list{1, 2};
+        list.EraseAfter(list.cbegin());
+        list.PushBack(3);
+        assert((list == SingleLinkedList<int>{1, 3}));
+
+        list.PopFront();
+        list.PopFront();
+        assert(list.IsEmpty());
+        list.PushBack(7);
+        assert((list == SingleLinkedList<int>{7}));
+
+        SingleLinkedList<int> other;
+        list.swap(other);
+        other.PushBack(8);
+        list.PushBack(9);
+        assert((other == SingleLinkedList<int>{7, 8}));
+        assert((list == SingleLinkedList<int>{9}));
+
+        SingleLinkedList<int> moved(std::move(other));
+        moved.PushBack(10);
+        assert((moved == SingleLinkedList<int>{7, 8, 10}));
+    }
+
+    // EmplaceBack конструирует элемент на месте и возвращает ссылку
+    {
+        SingleLinkedList<std::string> list;
+        list.EmplaceBack(3, 'x') += "y";
+        assert(*list.begin() == "xxxy");
+    }
+}
+
+void TestChunkedList() {
+    // Базовые операции повторяют семантику SingleLinkedList
+    {
+        ChunkedLinkedList<int> list{1, 2, 3};
+        assert(list.GetSize() == 3u);
+        assert(!list.IsEmpty());
+        assert(++list.before_begin() == list.begin());
+        assert((list == ChunkedLinkedList<int>{1, 2, 3}));
+        list.PopFront();
+        assert((list == ChunkedLinkedList<int>{2, 3}));
+        list.PushFront(0);
+        assert((list == ChunkedLinkedList<int>{0, 2, 3}));
+    }
+
+    // Маленькие чанки: вставка в середину вызывает расщепление чанков
+    {
+        ChunkedLinkedList<int, 4> list;
+        auto it = list.before_begin();
+        for (int i = 0; i < 20; ++i) {
+            it = list.InsertAfter(it, i);
+        }
+        assert(list.GetSize() == 20u);
+        int expected = 0;
+        for (int value : list) {
+            assert(value == expected);
+            ++expected;
+        }
+
+        // Вставка после каждого чётного элемента
+        auto pos = list.cbegin();
+        const auto inserted = list.InsertAfter(pos, 100);
+        assert(*inserted == 100);
+        assert(list.GetSize() == 21u);
+        auto check = list.begin();
+        assert(*check == 0);
+        assert(*(++check) == 100);
+        assert(*(++check) == 1);
+    }
+
+    // Удаление через границы чанков, включая схлопывание пустых чанков
+    {
+        ChunkedLinkedList<int, 2> list{1, 2, 3, 4, 5};
+        auto item_after_erased = list.EraseAfter(list.cbefore_begin());
+        assert(item_after_erased == list.begin());
+        assert((list == ChunkedLinkedList<int, 2>{2, 3, 4, 5}));
+
+        while (!list.IsEmpty()) {
+            list.PopFront();
+        }
+        assert(list.GetSize() == 0u);
+        assert(list.begin() == list.end());
+    }
+
+    // Копирование и перемещение
+    {
+        ChunkedLinkedList<std::string, 3> source{"a", "b", "c", "d"};
+        ChunkedLinkedList<std::string, 3> copy(source);
+        assert(copy == source);
+        ChunkedLinkedList<std::string, 3> moved(std::move(copy));
+        assert(moved == source);
+        assert(copy.IsEmpty());
+    }
+}
 
 void Test() {
     struct DeletionSpy {
@@ -146,4 +1722,37 @@ void Test() {
 
 int main() {
     Test();
+    TestAllocatorAwareness();
+    TestArenaClear();
+    TestInlinePool();
+    TestMoveSemantics();
+    TestEmplace();
+    TestChunkedList();
+    TestChunkedComparisons();
+    TestPushBack();
+    TestRangeAssign();
+    TestComparisons();
+    TestContentHash();
+    TestSerialization();
+    TestFrozenList();
+    TestDenseView();
+    TestSnapshotSharing();
+    TestStaticList();
+    TestPrefetchIteration();
+    TestConcurrentList();
+    TestConcurrentReclamation();
+    TestParallelAlgorithms();
+    TestSpliceAfter();
+    TestSkipIndex();
+    TestInsertSorted();
+    TestSort();
+    TestParallelSort();
+    TestReverseAndMerge();
+    TestRemoveIfAndUnique();
+#ifdef SINGLE_LINKED_LIST_STATS
+    TestStats();
+#endif
+#ifdef SINGLE_LINKED_LIST_DEBUG_ITERATORS
+    TestDebugIterators();
+#endif
 }
\ No newline at end of file
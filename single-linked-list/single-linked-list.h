@@ -3,21 +3,68 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+// Счётчики телеметрии списка; заполняются только при сборке
+// с -DSINGLE_LINKED_LIST_STATS, иначе все хуки — пустые no-op
+#ifdef SINGLE_LINKED_LIST_STATS
+struct SingleLinkedListStats {
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    // Узлы, пройденные внутренними операциями списка
+    // (Sort, Reverse, RemoveIf, Unique, сплайс диапазона)
+    size_t nodes_traversed = 0;
+    size_t peak_size = 0;
+};
+#endif
+
+// Определяет, умеет ли аллокатор освобождать всю выданную память разом
+// через член ReleaseAll() (как ArenaAllocator из arena-allocator.h)
+template <typename Allocator, typename = void>
+struct AllocatorHasReleaseAll : std::false_type {};
+
+template <typename Allocator>
+struct AllocatorHasReleaseAll<Allocator,
+    std::void_t<decltype(std::declval<Allocator&>().ReleaseAll())>> : std::true_type {};
+
+// Определяет, есть ли у типа специализация std::hash — от этого зависит,
+// ведёт ли список инкрементальный хеш содержимого
+template <typename Type, typename = void>
+struct IsStdHashable : std::false_type {};
 
 template <typename Type>
+struct IsStdHashable<Type,
+    std::void_t<decltype(std::hash<Type>{}(std::declval<const Type&>()))>> : std::true_type {};
+
+template <typename Type, typename Allocator = std::allocator<Type>>
 class SingleLinkedList {
     struct Node {
         Node() = default;
-        Node(const Type& val, Node* next)
-            : value(val)
+        // Конструирует значение прямо в узле из произвольного набора аргументов
+        template <typename... Args>
+        explicit Node(Node* next, Args&&... args)
+            : value(std::forward<Args>(args)...)
             , next_node(next) {
         }
         Type value;
         Node* next_node = nullptr;
     };
 
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAllocator>;
+
     template <typename ValueType>
     class BasicIterator {
     friend class SingleLinkedList;
@@ -25,6 +72,14 @@ class SingleLinkedList {
         explicit BasicIterator(Node* node) : node_(node) {
         }
 
+#ifdef SINGLE_LINKED_LIST_DEBUG_ITERATORS
+        BasicIterator(Node* node, const SingleLinkedList* owner, uint64_t generation)
+            : node_(node)
+            , owner_(owner)
+            , generation_(generation) {
+        }
+#endif
+
     public:
         using iterator_category = std::forward_iterator_tag;
         using value_type = Type;
@@ -36,6 +91,10 @@ class SingleLinkedList {
 
         BasicIterator(const BasicIterator<Type>& other) noexcept {
             node_ = other.node_;
+#ifdef SINGLE_LINKED_LIST_DEBUG_ITERATORS
+            owner_ = other.owner_;
+            generation_ = other.generation_;
+#endif
         }
 
         BasicIterator& operator=(const BasicIterator& rhs) = default;
@@ -58,6 +117,7 @@ class SingleLinkedList {
 
         BasicIterator& operator++() noexcept {
             assert(node_ != nullptr);
+            AssertNotInvalidated();
 
             node_ = node_->next_node;
             return *this;
@@ -69,6 +129,103 @@ class SingleLinkedList {
             return old_copy;
         }
 
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(node_ != nullptr);
+            AssertNotInvalidated();
+
+            return node_->value;
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            assert(node_ != nullptr);
+            AssertNotInvalidated();
+
+            return &node_->value;
+        }
+
+    private:
+        // В отладочном режиме расхождение поколений означает, что после
+        // выдачи итератора список пережил удаление узлов; в релизе
+        // проверка не существует и итератор остаётся голым указателем
+        void AssertNotInvalidated() const noexcept {
+#ifdef SINGLE_LINKED_LIST_DEBUG_ITERATORS
+            assert(owner_ == nullptr || owner_->generation_ == generation_);
+#endif
+        }
+
+        Node* node_ = nullptr;
+#ifdef SINGLE_LINKED_LIST_DEBUG_ITERATORS
+        const SingleLinkedList* owner_ = nullptr;
+        uint64_t generation_ = 0;
+#endif
+    };
+
+    // Аппаратная подсказка "эти данные скоро понадобятся"; на прочих
+    // компиляторах — пустая операция
+    static void PrefetchRead(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 1);
+#else
+        static_cast<void>(address);
+#endif
+    }
+
+    // Итератор потокового чтения: параллельно с основной позицией ведёт
+    // разведчика на kPrefetchDepth узлов впереди и на каждом шаге выдаёт
+    // программную предвыборку его узла. К моменту, когда обход доходит до
+    // узла, тот уже подтянут в кэш — длинные сканы холодных списков не
+    // останавливаются на каждом промахе. Только для чтения вперёд; для
+    // точечной навигации остаётся BasicIterator
+    template <typename ValueType>
+    class BasicPrefetchIterator {
+    friend class SingleLinkedList;
+
+        explicit BasicPrefetchIterator(Node* node) : node_(node), scout_(node) {
+            // Разгон: уводим разведчика вперёд, предвыбирая каждый узел
+            for (size_t i = 0; i < kPrefetchDepth && scout_ != nullptr; ++i) {
+                scout_ = scout_->next_node;
+                if (scout_ != nullptr) {
+                    PrefetchRead(scout_);
+                }
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicPrefetchIterator() = default;
+
+        [[nodiscard]] bool operator==(const BasicPrefetchIterator& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicPrefetchIterator& rhs) const noexcept {
+            return node_ != rhs.node_;
+        }
+
+        BasicPrefetchIterator& operator++() noexcept {
+            assert(node_ != nullptr);
+
+            node_ = node_->next_node;
+            if (scout_ != nullptr) {
+                scout_ = scout_->next_node;
+                if (scout_ != nullptr) {
+                    PrefetchRead(scout_);
+                }
+            }
+            return *this;
+        }
+
+        BasicPrefetchIterator operator++(int) noexcept {
+            BasicPrefetchIterator old_copy(*this);
+            ++(*this);
+            return old_copy;
+        }
+
         [[nodiscard]] reference operator*() const noexcept {
             assert(node_ != nullptr);
 
@@ -83,61 +240,150 @@ class SingleLinkedList {
 
     private:
         Node* node_ = nullptr;
+        // Бежит на kPrefetchDepth узлов впереди node_
+        Node* scout_ = nullptr;
     };
 
 public:
     using value_type = Type;
     using reference = value_type&;
     using const_reference = const value_type&;
+    using allocator_type = Allocator;
 
     using Iterator = BasicIterator<Type>;
     using ConstIterator = BasicIterator<const Type>;
 
+    using PrefetchIterator = BasicPrefetchIterator<Type>;
+    using ConstPrefetchIterator = BasicPrefetchIterator<const Type>;
+
+    // Шаг скип-индекса: указатель запоминается на каждый такой узел
+    static constexpr size_t kSkipIndexStride = 1024;
+
+    // Дистанция разведчика потокового итератора: на сколько узлов вперёд
+    // уходит предвыборка
+    static constexpr size_t kPrefetchDepth = 8;
+
     [[nodiscard]] Iterator begin() noexcept {
-        return Iterator{head_.next_node};
+        return MakeIterator(head_.next_node);
     }
 
     [[nodiscard]] Iterator end() noexcept {
-        return Iterator{nullptr};
+        return MakeIterator(nullptr);
     }
 
     [[nodiscard]] ConstIterator begin() const noexcept {
-        return ConstIterator{head_.next_node};
+        return MakeConstIterator(head_.next_node);
     }
 
     [[nodiscard]] ConstIterator end() const noexcept {
-        return ConstIterator{nullptr};
+        return MakeConstIterator(nullptr);
     }
 
     [[nodiscard]] ConstIterator cbegin() const noexcept {
-        return ConstIterator{head_.next_node};
+        return MakeConstIterator(head_.next_node);
     }
 
     [[nodiscard]] ConstIterator cend() const noexcept {
-        return ConstIterator{nullptr};
+        return MakeConstIterator(nullptr);
     }
 
     [[nodiscard]] Iterator before_begin() noexcept {
-        return Iterator{&head_};
+        return MakeIterator(&head_);
     }
 
     [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
-        return ConstIterator{const_cast<Node*>(&head_)};
+        return MakeConstIterator(const_cast<Node*>(&head_));
     }
 
     [[nodiscard]] ConstIterator before_begin() const noexcept {
-        return ConstIterator{&head_};
+        return MakeConstIterator(const_cast<Node*>(&head_));
+    }
+
+    // Потоковый обход с предвыборкой — для длинных линейных сканов
+    // холодных списков
+    [[nodiscard]] PrefetchIterator prefetch_begin() noexcept {
+        return PrefetchIterator{head_.next_node};
+    }
+
+    [[nodiscard]] PrefetchIterator prefetch_end() noexcept {
+        return PrefetchIterator{nullptr};
+    }
+
+    [[nodiscard]] ConstPrefetchIterator prefetch_begin() const noexcept {
+        return ConstPrefetchIterator{head_.next_node};
+    }
+
+    [[nodiscard]] ConstPrefetchIterator prefetch_end() const noexcept {
+        return ConstPrefetchIterator{nullptr};
     }
 
     Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return EmplaceAfter(pos, value);
+    }
+
+    Iterator InsertAfter(ConstIterator pos, Type&& value) {
+        return EmplaceAfter(pos, std::move(value));
+    }
+
+    // Конструирует элемент на месте внутри нового узла после pos,
+    // без промежуточного объекта Type
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
         assert(pos.node_ != nullptr);
 
         Node* current = pos.node_;
         Node* next_node = current->next_node;
-        Node* new_node = new Node(value, next_node);
+        Node* new_node = CreateNode(next_node, std::forward<Args>(args)...);
         current->next_node = new_node;
+        if (current == tail_) {
+            tail_ = new_node;
+        }
         ++size_;
-        return Iterator{new_node};
+        InvalidateCaches();
+        return MakeIterator(new_node);
+    }
+
+    Iterator InsertSorted(const Type& value) {
+        return InsertSorted(cbefore_begin(), value, std::less<Type>());
+    }
+
+    Iterator InsertSorted(Type&& value) {
+        return InsertSorted(cbefore_begin(), std::move(value), std::less<Type>());
+    }
+
+    template <typename Compare>
+    Iterator InsertSorted(const Type& value, Compare cmp) {
+        return InsertSorted(cbefore_begin(), value, std::move(cmp));
+    }
+
+    template <typename Compare>
+    Iterator InsertSorted(Type&& value, Compare cmp) {
+        return InsertSorted(cbefore_begin(), std::move(value), std::move(cmp));
+    }
+
+    Iterator InsertSorted(ConstIterator hint, const Type& value) {
+        return InsertSorted(hint, value, std::less<Type>());
+    }
+
+    Iterator InsertSorted(ConstIterator hint, Type&& value) {
+        return InsertSorted(hint, std::move(value), std::less<Type>());
+    }
+
+    template <typename Compare>
+    Iterator InsertSorted(ConstIterator hint, const Type& value, Compare cmp) {
+        return EmplaceAfter(ConstIterator{FindSortedPosition(hint, value, cmp)}, value);
+    }
+
+    // Вставляет value в отсортированный список, сохраняя порядок.
+    // Поиск позиции начинается с подсказки hint: для почти
+    // отсортированного потока вставок с подсказкой от предыдущей
+    // позиции амортизированная стоимость — O(1) вместо O(n).
+    // Непригодная подсказка (её элемент больше value) безопасно
+    // откатывает поиск к началу списка. Равные элементы встают после
+    // уже имеющихся — порядок поступления сохраняется
+    template <typename Compare>
+    Iterator InsertSorted(ConstIterator hint, Type&& value, Compare cmp) {
+        return EmplaceAfter(ConstIterator{FindSortedPosition(hint, value, cmp)}, std::move(value));
     }
 
     Iterator EraseAfter(ConstIterator pos) noexcept {
@@ -146,119 +392,1098 @@ public:
         Node* current = pos.node_;
         Node* to_delete = current->next_node;
         Node* next_node = current->next_node->next_node;
-        delete to_delete;
+        if (to_delete == tail_) {
+            tail_ = current;
+        }
+        DestroyNode(to_delete);
         --size_;
         current->next_node = next_node;
-        return Iterator{current->next_node};
+        InvalidateCaches();
+        InvalidateIterators();
+        return MakeIterator(current->next_node);
     }
 
     SingleLinkedList() : size_(0) {
     }
 
-    SingleLinkedList(std::initializer_list<Type> values) {
-        CopyAndSwap(values);
+    explicit SingleLinkedList(const Allocator& alloc)
+        : node_alloc_(alloc)
+        , size_(0) {
+    }
+
+    SingleLinkedList(std::initializer_list<Type> values, const Allocator& alloc = Allocator())
+        : node_alloc_(alloc) {
+        Assign(values.begin(), values.end());
     }
 
-    SingleLinkedList(const SingleLinkedList& other)  {
-        CopyAndSwap(other);
+    // Конструктор от произвольного диапазона итераторов
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    SingleLinkedList(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+        : node_alloc_(alloc) {
+        Assign(first, last);
+    }
+
+    SingleLinkedList(const SingleLinkedList& other)
+        : node_alloc_(NodeAllocTraits::select_on_container_copy_construction(other.node_alloc_)) {
+        Assign(other.begin(), other.end());
+    }
+
+    SingleLinkedList(const SingleLinkedList& other, const Allocator& alloc)
+        : node_alloc_(alloc) {
+        Assign(other.begin(), other.end());
+    }
+
+    SingleLinkedList(SingleLinkedList&& other) noexcept
+        : node_alloc_(std::move(other.node_alloc_)) {
+        SwapData(other);
     }
 
     SingleLinkedList& operator=(const SingleLinkedList& rhs) {
         if (this != &rhs) {
-            SingleLinkedList copy_rhs(rhs);
-            swap(copy_rhs);
+            if (NodeAllocTraits::propagate_on_container_copy_assignment::value) {
+                Clear();
+                node_alloc_ = rhs.node_alloc_;
+            }
+            // Копия строится узлами нашего аллокатора, поэтому обмен данными безопасен
+            Assign(rhs.begin(), rhs.end());
+        }
+        return *this;
+    }
+
+    SingleLinkedList& operator=(SingleLinkedList&& rhs) {
+        if (this != &rhs) {
+            if constexpr (NodeAllocTraits::propagate_on_container_move_assignment::value) {
+                Clear();
+                node_alloc_ = std::move(rhs.node_alloc_);
+                SwapData(rhs);
+            } else if (node_alloc_ == rhs.node_alloc_) {
+                Clear();
+                SwapData(rhs);
+            } else {
+                // Аллокаторы разные и не переносятся: узлы rhs нам чужие,
+                // приходится переносить элементы поштучно в свои узлы
+                SingleLinkedList moved_rhs(get_allocator());
+                auto insert_after_it = moved_rhs.before_begin();
+                for (auto& value : rhs) {
+                    moved_rhs.InsertAfter(insert_after_it, std::move(value));
+                    ++insert_after_it;
+                }
+                Clear();
+                SwapData(moved_rhs);
+                rhs.Clear();
+            }
         }
         return *this;
     }
-   
+
+    // Заменяет содержимое списка элементами диапазона [first, last).
+    // Узлы выделяются и связываются одним плотным проходом без поиска
+    // точки вставки; при исключении список остаётся нетронутым
+    template <typename InputIt>
+    void Assign(InputIt first, InputIt last) {
+        SingleLinkedList result(get_allocator());
+        Node* cursor = &result.head_;
+        for (; first != last; ++first) {
+            cursor->next_node = result.CreateNode(nullptr, *first);
+            cursor = cursor->next_node;
+            ++result.size_;
+        }
+        result.tail_ = cursor;
+        SwapData(result);
+    }
+
     void swap(SingleLinkedList& other) noexcept {
-        std::swap(head_.next_node, other.head_.next_node);
-        std::swap(size_, other.size_);
+        SwapData(other);
+        if (NodeAllocTraits::propagate_on_container_swap::value) {
+            std::swap(node_alloc_, other.node_alloc_);
+        }
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept {
+        return allocator_type(node_alloc_);
     }
 
+#ifdef SINGLE_LINKED_LIST_STATS
+    [[nodiscard]] const SingleLinkedListStats& Stats() const noexcept {
+        return stats_;
+    }
+#endif
+
     [[nodiscard]] size_t GetSize() const noexcept {
         return size_;
     }
 
+    // Лексикографическое сравнение за один проход: возвращает
+    // отрицательное, ноль или положительное число. Все операторы
+    // порядка выражаются через него без повторных обходов
+    [[nodiscard]] int Compare(const SingleLinkedList& other) const {
+        const Node* left = head_.next_node;
+        const Node* right = other.head_.next_node;
+        while (left != nullptr && right != nullptr) {
+            if (left->value < right->value) {
+                return -1;
+            }
+            if (right->value < left->value) {
+                return 1;
+            }
+            left = left->next_node;
+            right = right->next_node;
+        }
+        if (left == nullptr && right == nullptr) {
+            return 0;
+        }
+        return left == nullptr ? -1 : 1;
+    }
+
+    // Хеш содержимого: сумма перемешанных хешей элементов, посоленных
+    // позицией от хвоста. Такая схема позволяет PushFront/PopFront
+    // обновлять значение за O(1) — позиции существующих элементов от
+    // хвоста при росте спереди не меняются. После прочих структурных
+    // изменений и после ForEach хеш лениво пересчитывается одним проходом.
+    // Контракт: запись в элемент через неконстантный итератор (*it = x)
+    // кешем не отслеживается, и закешированный хеш устаревает — как ключи
+    // unordered_map, элементы, участвующие в хешировании, нельзя менять
+    // на месте; меняйте их через ForEach или перестройкой списка.
+    // Только для типов со специализацией std::hash
+    template <typename U = Type, typename = std::enable_if_t<IsStdHashable<U>::value>>
+    [[nodiscard]] uint64_t Hash() const {
+        if (!hash_valid_) {
+            content_hash_ = 0;
+            size_t position_from_tail = size_;
+            for (const Node* node = head_.next_node; node != nullptr; node = node->next_node) {
+                --position_from_tail;
+                content_hash_ += MixElementHash(node->value, position_from_tail);
+            }
+            hash_valid_ = true;
+        }
+        return content_hash_;
+    }
+
+    // Равенство с быстрым отказом по размеру. Кешированный хеш здесь
+    // сознательно не используется: запись через неконстантный итератор
+    // кеш не сбрасывает, и устаревший хеш давал бы ложный отказ
+    [[nodiscard]] bool EqualTo(const SingleLinkedList& other) const {
+        // Сравнение размеров отсекает несовпадение за O(1) и защищает
+        // std::equal от выхода за конец более короткого правого списка
+        if (size_ != other.size_) {
+            return false;
+        }
+        return std::equal(begin(), end(), other.begin());
+    }
 
     [[nodiscard]] bool IsEmpty() const noexcept {
         return size_ == 0 ? true : false;
     }
 
     void PushFront(const Type& value) {
-        head_.next_node = new Node(value, head_.next_node);
+        EmplaceFront(value);
+    }
+
+    void PushFront(Type&& value) {
+        EmplaceFront(std::move(value));
+    }
+
+    // Конструирует элемент на месте в начале списка
+    template <typename... Args>
+    reference EmplaceFront(Args&&... args) {
+        const bool hash_was_valid = hash_valid_;
+        head_.next_node = CreateNode(head_.next_node, std::forward<Args>(args)...);
+        if (tail_ == &head_) {
+            tail_ = head_.next_node;
+        }
         ++size_;
+        InvalidateCaches();
+        // Рост спереди не меняет позиции остальных элементов от хвоста:
+        // хеш дополняется вкладом нового элемента за O(1)
+        if constexpr (IsStdHashable<Type>::value) {
+            if (hash_was_valid) {
+                content_hash_ += MixElementHash(head_.next_node->value, size_ - 1);
+                hash_valid_ = true;
+            }
+        }
+        return head_.next_node->value;
+    }
+
+    // Возвращает итератор на элемент с порядковым номером index, прыгая
+    // через ленивый скип-индекс (указатель на каждый kSkipIndexStride-й
+    // узел) и проходя пешком только остаток. Первый вызов после
+    // структурного изменения перестраивает индекс за один проход
+    [[nodiscard]] Iterator IteratorAt(size_t index) {
+        assert(index < size_);
+
+        return MakeIterator(NodeAt(index));
+    }
+
+    [[nodiscard]] ConstIterator IteratorAt(size_t index) const {
+        assert(index < size_);
+
+        return MakeConstIterator(NodeAt(index));
+    }
+
+    // Продвигает итератор it, стоящий на позиции current_index, на n
+    // элементов вперёд через скип-индекс вместо n инкрементов
+    [[nodiscard]] ConstIterator AdvanceFast(ConstIterator it, size_t current_index, size_t n) const {
+        assert(it.node_ != nullptr);
+        assert(current_index + n < size_);
+
+        // Дальний прыжок выгоднее начинать от индексной отметки
+        if (n >= kSkipIndexStride) {
+            return MakeConstIterator(NodeAt(current_index + n));
+        }
+        Node* node = it.node_;
+        for (size_t i = 0; i < n; ++i) {
+            node = node->next_node;
+        }
+        return MakeConstIterator(node);
+    }
+
+    // Плотное представление "структура массивов": значения лежат подряд
+    // в порядке обхода, без перемежающихся указателей next_node. Копия
+    // строится лениво при первом обращении и сбрасывается структурными
+    // изменениями; по ней компилятор векторизует линейные проходы,
+    // которые по цепочке узлов шли бы по одному промаху кэша на элемент
+    [[nodiscard]] const std::vector<Type>& ToDenseView() const {
+        if (!dense_cache_valid_) {
+            dense_cache_.clear();
+            dense_cache_.reserve(size_);
+            for (const Node* node = head_.next_node; node != nullptr; node = node->next_node) {
+                dense_cache_.push_back(node->value);
+            }
+            dense_cache_valid_ = true;
+        }
+        return dense_cache_;
+    }
+
+    // Сумма элементов одним линейным проходом по плотному представлению.
+    // Только для арифметических типов
+    template <typename U = Type, typename = std::enable_if_t<std::is_arithmetic_v<U>>>
+    [[nodiscard]] Type Sum() const {
+        const std::vector<Type>& values = ToDenseView();
+        Type total{};
+        for (size_t i = 0; i < values.size(); ++i) {
+            total += values[i];
+        }
+        return total;
+    }
+
+    // Минимум и максимум за один проход по плотному представлению.
+    // Список не должен быть пустым
+    template <typename U = Type, typename = std::enable_if_t<std::is_arithmetic_v<U>>>
+    [[nodiscard]] std::pair<Type, Type> MinMax() const {
+        assert(!IsEmpty());
+
+        const std::vector<Type>& values = ToDenseView();
+        Type lowest = values[0];
+        Type highest = values[0];
+        for (size_t i = 1; i < values.size(); ++i) {
+            lowest = values[i] < lowest ? values[i] : lowest;
+            highest = highest < values[i] ? values[i] : highest;
+        }
+        return {lowest, highest};
+    }
+
+    // Переносит все узлы other в позицию после pos за O(1), не выделяя
+    // и не копируя ничего. Аллокаторы списков должны быть равны
+    void SpliceAfter(ConstIterator pos, SingleLinkedList& other) noexcept {
+        assert(pos.node_ != nullptr);
+        assert(node_alloc_ == other.node_alloc_);
+
+        if (other.IsEmpty()) {
+            return;
+        }
+        Node* current = pos.node_;
+        Node* spliced_first = other.head_.next_node;
+        Node* spliced_last = other.tail_;
+        spliced_last->next_node = current->next_node;
+        current->next_node = spliced_first;
+        if (current == tail_) {
+            tail_ = spliced_last;
+        }
+        size_ += other.size_;
+        other.head_.next_node = nullptr;
+        other.tail_ = &other.head_;
+        other.size_ = 0;
+        InvalidateCaches();
+        other.InvalidateCaches();
+    }
+
+    // Переносит узлы диапазона (first, last) из other в позицию после pos.
+    // Сама перестыковка — O(1), но подсчёт перенесённых элементов для
+    // size_ требует прохода по диапазону
+    void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator first, ConstIterator last) noexcept {
+        assert(pos.node_ != nullptr);
+        assert(first.node_ != nullptr);
+        assert(node_alloc_ == other.node_alloc_);
+
+        Node* before = first.node_;
+        Node* after = last.node_;
+        if (before->next_node == after || before == pos.node_) {
+            return;
+        }
+        size_t count = 0;
+        Node* range_last = before;
+        while (range_last->next_node != after) {
+            range_last = range_last->next_node;
+            ++count;
+        }
+        StatsOnTraverse(count);
+        Node* range_first = before->next_node;
+        before->next_node = after;
+        if (other.tail_ == range_last) {
+            other.tail_ = before;
+        }
+        other.size_ -= count;
+
+        Node* current = pos.node_;
+        range_last->next_node = current->next_node;
+        current->next_node = range_first;
+        if (current == tail_) {
+            tail_ = range_last;
+        }
+        size_ += count;
+        InvalidateCaches();
+        other.InvalidateCaches();
+    }
+
+    void PushBack(const Type& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(Type&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    // Конструирует элемент на месте в конце списка за O(1)
+    // благодаря кешированному указателю на хвост
+    template <typename... Args>
+    reference EmplaceBack(Args&&... args) {
+        return *EmplaceAfter(ConstIterator{tail_}, std::forward<Args>(args)...);
     }
 
     void PopFront() noexcept {
         if (size_ != 0) {
+            const bool hash_was_valid = hash_valid_;
+            // Вклад первого элемента снимается до уничтожения узла
+            if constexpr (IsStdHashable<Type>::value) {
+                if (hash_was_valid) {
+                    content_hash_ -= MixElementHash(head_.next_node->value, size_ - 1);
+                }
+            }
             Node* next_node = head_.next_node->next_node;
-            delete head_.next_node;
+            if (tail_ == head_.next_node) {
+                tail_ = &head_;
+            }
+            DestroyNode(head_.next_node);
             --size_;
             head_.next_node = next_node;
+            InvalidateCaches();
+            InvalidateIterators();
+            if constexpr (IsStdHashable<Type>::value) {
+                hash_valid_ = hash_was_valid;
+            }
+        }
+    }
+
+    // Пишет список в поток в длино-префиксном бинарном формате:
+    // uint64_t с числом элементов, затем элементы подряд сырыми байтами
+    // (машинный порядок байтов). Только для тривиально копируемых типов
+    void Serialize(std::ostream& out) const {
+        static_assert(std::is_trivially_copyable_v<Type>,
+                      "Serialize requires a trivially copyable Type");
+
+        const uint64_t count = size_;
+        out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        for (const Node* node = head_.next_node; node != nullptr; node = node->next_node) {
+            out.write(reinterpret_cast<const char*>(&node->value), sizeof(Type));
+        }
+    }
+
+    // Восстанавливает список из потока одним плотным проходом: узлы
+    // выделяются и подвешиваются напрямую, байты элементов читаются
+    // прямо в value без промежуточного контейнера
+    static SingleLinkedList Deserialize(std::istream& in, const Allocator& alloc = Allocator()) {
+        static_assert(std::is_trivially_copyable_v<Type>,
+                      "Deserialize requires a trivially copyable Type");
+
+        uint64_t count = 0;
+        in.read(reinterpret_cast<char*>(&count), sizeof(count));
+        if (!in) {
+            throw std::runtime_error("SingleLinkedList::Deserialize: failed to read element count");
+        }
+        SingleLinkedList result(alloc);
+        Node* cursor = &result.head_;
+        for (uint64_t i = 0; i < count; ++i) {
+            cursor->next_node = result.CreateNode(nullptr);
+            cursor = cursor->next_node;
+            ++result.size_;
+            result.tail_ = cursor;
+            in.read(reinterpret_cast<char*>(&cursor->value), sizeof(Type));
+            if (!in) {
+                throw std::runtime_error("SingleLinkedList::Deserialize: truncated element data");
+            }
+        }
+        return result;
+    }
+
+    // Перегрузка для источников без копирования: разбирает готовый буфер
+    // того же формата (например, отображённый в память файл)
+    static SingleLinkedList Deserialize(const void* data, size_t size, const Allocator& alloc = Allocator()) {
+        static_assert(std::is_trivially_copyable_v<Type>,
+                      "Deserialize requires a trivially copyable Type");
+
+        const char* bytes = static_cast<const char*>(data);
+        uint64_t count = 0;
+        if (size < sizeof(count)) {
+            throw std::runtime_error("SingleLinkedList::Deserialize: buffer too small for element count");
+        }
+        std::memcpy(&count, bytes, sizeof(count));
+        // Проверка делением: произведение count * sizeof(Type) для
+        // враждебного префикса переполняется и обходит сравнение
+        if (count > (size - sizeof(count)) / sizeof(Type)) {
+            throw std::runtime_error("SingleLinkedList::Deserialize: truncated element data");
+        }
+        const char* element_bytes = bytes + sizeof(count);
+        SingleLinkedList result(alloc);
+        Node* cursor = &result.head_;
+        for (uint64_t i = 0; i < count; ++i) {
+            cursor->next_node = result.CreateNode(nullptr);
+            cursor = cursor->next_node;
+            ++result.size_;
+            result.tail_ = cursor;
+            std::memcpy(&cursor->value, element_bytes + i * sizeof(Type), sizeof(Type));
+        }
+        return result;
+    }
+
+    // Применяет f к каждому элементу, разбив цепочку на сегменты и
+    // обработав их пулом потоков. Границы сегментов находятся одним
+    // проходом по указателям; при parallelism <= 1 или коротком списке
+    // выполняется обычный последовательный обход
+    template <typename Function>
+    void ForEach(Function f, size_t parallelism = std::thread::hardware_concurrency()) {
+        ForEachImpl(head_.next_node, size_, std::move(f), parallelism);
+        // Функтор мог изменить элементы — производные структуры
+        // (плотная копия, хеш) больше не отражают содержимое
+        InvalidateCaches();
+    }
+
+    template <typename Function>
+    void ForEach(Function f, size_t parallelism = std::thread::hardware_concurrency()) const {
+        // const Node* гарантирует, что функтор получает const Type&
+        // и не может изменить элементы константного списка
+        ForEachImpl(static_cast<const Node*>(head_.next_node), size_, std::move(f), parallelism);
+    }
+
+    // Параллельная свёртка: transform применяется к элементам по
+    // сегментам, частичные результаты сегментов сводятся reduce
+    // в порядке следования сегментов
+    template <typename Transform, typename Reduce, typename Value>
+    [[nodiscard]] Value TransformReduce(Transform transform, Reduce reduce, Value init,
+                                        size_t parallelism = std::thread::hardware_concurrency()) const {
+        const size_t segments = SegmentCount(size_, parallelism);
+        if (segments <= 1) {
+            Value result = std::move(init);
+            for (const Node* node = head_.next_node; node != nullptr; node = node->next_node) {
+                result = reduce(std::move(result), transform(node->value));
+            }
+            return result;
+        }
+
+        // Сегменты непусты, поэтому частичный результат сегмента
+        // затравливается преобразованием его первого элемента,
+        // а init участвует в свёртке ровно один раз
+        std::vector<Value> partials(segments, init);
+        RunSegmented(head_.next_node, size_, segments,
+                     [&partials, &transform, &reduce](size_t segment, const Node* first, size_t count) {
+            Value partial = transform(first->value);
+            for (const Node* node = first->next_node; count > 1; node = node->next_node, --count) {
+                partial = reduce(std::move(partial), transform(node->value));
+            }
+            partials[segment] = std::move(partial);
+        });
+
+        Value result = std::move(init);
+        for (Value& partial : partials) {
+            result = reduce(std::move(result), std::move(partial));
+        }
+        return result;
+    }
+
+    void Sort() {
+        Sort(std::less<Type>());
+    }
+
+    // Итеративная восходящая сортировка слиянием поверх связей узлов:
+    // O(n log n) сравнений, O(1) дополнительной памяти, без выделений.
+    // Сортировка устойчива: равные элементы сохраняют взаимный порядок
+    template <typename Compare>
+    void Sort(Compare cmp) {
+        if (size_ < 2) {
+            return;
+        }
+        for (size_t width = 1; width < size_; width *= 2) {
+            StatsOnTraverse(size_);
+            Node* merged_tail = &head_;
+            Node* rest = head_.next_node;
+            while (rest) {
+                // Отрезаем от остатка две серии длиной до width и сливаем их
+                Node* left = rest;
+                Node* right = CutRun(left, width);
+                rest = CutRun(right, width);
+                merged_tail = MergeRuns(merged_tail, left, right, cmp);
+            }
+            tail_ = merged_tail;
+        }
+        InvalidateCaches();
+    }
+
+    void ParallelSort(size_t parallelism = std::thread::hardware_concurrency()) {
+        ParallelSort(std::less<Type>(), parallelism);
+    }
+
+    // Параллельная сортировка: цепочка режется на сегменты по числу
+    // потоков, каждый сегмент сортируется своим потоком той же восходящей
+    // сортировкой слиянием, затем отсортированные сегменты сливаются
+    // попарными перестыковками узлов. Элементы не копируются вовсе.
+    // Сортировка устойчива: сегменты сливаются в порядке следования,
+    // а слияние отдаёт приоритет левому. SFINAE-ограничение отделяет
+    // компаратор от вызова ParallelSort(parallelism) с одним числом
+    template <typename Compare,
+              typename = std::enable_if_t<std::is_invocable_r_v<bool, Compare&, const Type&, const Type&>>>
+    void ParallelSort(Compare cmp, size_t parallelism = std::thread::hardware_concurrency()) {
+        const size_t segments = SegmentCount(size_, parallelism);
+        if (segments <= 1) {
+            Sort(cmp);
+            return;
+        }
+
+        // Режем цепочку на независимые null-терминированные куски —
+        // только после этого потоки могут перестыковывать их связи
+        std::vector<Node*> heads;
+        std::vector<size_t> lengths;
+        heads.reserve(segments);
+        lengths.reserve(segments);
+        const size_t base_length = size_ / segments;
+        const size_t longer_segments = size_ % segments;
+        Node* rest = head_.next_node;
+        for (size_t segment = 0; segment < segments; ++segment) {
+            const size_t length = base_length + (segment < longer_segments ? 1 : 0);
+            heads.push_back(rest);
+            lengths.push_back(length);
+            rest = CutRun(rest, length);
+        }
+
+        // Сегменты сортируются независимо; последний — текущим потоком
+        std::vector<std::thread> workers;
+        workers.reserve(segments - 1);
+        for (size_t segment = 0; segment + 1 < segments; ++segment) {
+            workers.emplace_back([&heads, &lengths, &cmp, segment] {
+                SortChain(heads[segment], lengths[segment], cmp);
+            });
+        }
+        SortChain(heads[segments - 1], lengths[segments - 1], cmp);
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        // Попарные раунды слияний: O(n log k) перестыковок при k сегментах
+        while (heads.size() > 1) {
+            StatsOnTraverse(size_);
+            std::vector<Node*> merged;
+            merged.reserve((heads.size() + 1) / 2);
+            for (size_t i = 0; i + 1 < heads.size(); i += 2) {
+                merged.push_back(MergeChains(heads[i], heads[i + 1], cmp));
+            }
+            if (heads.size() % 2 != 0) {
+                merged.push_back(heads.back());
+            }
+            heads.swap(merged);
+        }
+        head_.next_node = heads.front();
+        Node* last = &head_;
+        while (last->next_node != nullptr) {
+            last = last->next_node;
+        }
+        tail_ = last;
+        InvalidateCaches();
+    }
+
+    // Разворачивает список за один проход, переставляя связи узлов;
+    // элементы не копируются и не перемещаются
+    void Reverse() noexcept {
+        if (size_ < 2) {
+            return;
+        }
+        StatsOnTraverse(size_);
+        Node* prev = nullptr;
+        Node* current = head_.next_node;
+        tail_ = current;
+        while (current) {
+            Node* next_node = current->next_node;
+            current->next_node = prev;
+            prev = current;
+            current = next_node;
+        }
+        head_.next_node = prev;
+        InvalidateCaches();
+    }
+
+    void Merge(SingleLinkedList& other) {
+        Merge(other, std::less<Type>());
+    }
+
+    // Сливает два отсортированных списка чистой перестыковкой узлов,
+    // оставляя other пустым. Слияние устойчиво: при равенстве элементы
+    // этого списка идут раньше элементов other
+    template <typename Compare>
+    void Merge(SingleLinkedList& other, Compare cmp) {
+        assert(node_alloc_ == other.node_alloc_);
+
+        if (this == &other || other.IsEmpty()) {
+            return;
+        }
+        Node* left = head_.next_node;
+        Node* right = other.head_.next_node;
+        head_.next_node = nullptr;
+        tail_ = MergeRuns(&head_, left, right, cmp);
+        size_ += other.size_;
+        other.head_.next_node = nullptr;
+        other.tail_ = &other.head_;
+        other.size_ = 0;
+        InvalidateCaches();
+        other.InvalidateCaches();
+    }
+
+    // Отцепляет все элементы, удовлетворяющие предикату, за один проход.
+    // Отцепленные узлы собираются в отдельную цепочку и возвращаются
+    // аллокатору одной пачкой в конце. Возвращает число удалённых
+    template <typename Predicate>
+    size_t RemoveIf(Predicate pred) {
+        StatsOnTraverse(size_);
+        Node* removed_chain = nullptr;
+        size_t removed = 0;
+        Node* current = &head_;
+        while (current->next_node) {
+            if (pred(current->next_node->value)) {
+                Node* to_remove = current->next_node;
+                current->next_node = to_remove->next_node;
+                to_remove->next_node = removed_chain;
+                removed_chain = to_remove;
+                ++removed;
+            } else {
+                current = current->next_node;
+            }
+        }
+        tail_ = current;
+        size_ -= removed;
+        InvalidateCaches();
+        InvalidateIterators();
+        ReclaimChain(removed_chain);
+        return removed;
+    }
+
+    size_t Unique() {
+        return Unique(std::equal_to<Type>());
+    }
+
+    // Удаляет подряд идущие элементы, равные предыдущему (в отсортированном
+    // списке — все дубликаты), той же пакетной схемой, что и RemoveIf
+    template <typename BinaryPredicate>
+    size_t Unique(BinaryPredicate equal) {
+        if (size_ < 2) {
+            return 0;
+        }
+        StatsOnTraverse(size_);
+        Node* removed_chain = nullptr;
+        size_t removed = 0;
+        Node* current = head_.next_node;
+        while (current->next_node) {
+            if (equal(current->value, current->next_node->value)) {
+                Node* to_remove = current->next_node;
+                current->next_node = to_remove->next_node;
+                to_remove->next_node = removed_chain;
+                removed_chain = to_remove;
+                ++removed;
+            } else {
+                current = current->next_node;
+            }
         }
+        tail_ = current;
+        size_ -= removed;
+        InvalidateCaches();
+        InvalidateIterators();
+        ReclaimChain(removed_chain);
+        return removed;
     }
 
+    // Всегда поузловая очистка: арену, которую могут разделять другие
+    // списки и временные объекты внутренних операций, Clear() не трогает.
+    // Массовый сброс арены — только явный ClearAndReleaseAll()
     void Clear() noexcept {
         while (head_.next_node) {
             Node* next_node = head_.next_node->next_node;
-            delete head_.next_node;
+            DestroyNode(head_.next_node);
             head_.next_node = next_node;
             --size_;
         }
+        tail_ = &head_;
+        InvalidateCaches();
+        InvalidateIterators();
+    }
+
+    // Очистка с O(1) сбросом арены целиком, без обхода узлов. Звать
+    // можно только когда список монопольно владеет содержимым арены:
+    // сброс освобождает и узлы всех прочих списков на той же арене.
+    // Для аллокаторов без ReleaseAll эквивалентно Clear()
+    void ClearAndReleaseAll() noexcept {
+        if constexpr (AllocatorHasReleaseAll<NodeAllocator>::value
+                      && std::is_trivially_destructible_v<Type>) {
+            // Деструкторы звать не нужно, а память цепочки целиком
+            // принадлежит арене
+            head_.next_node = nullptr;
+            size_ = 0;
+            node_alloc_.ReleaseAll();
+            tail_ = &head_;
+            InvalidateCaches();
+            InvalidateIterators();
+        } else {
+            Clear();
+        }
     }
 
     ~SingleLinkedList() {
         Clear();
     }
-private: 
-    template <typename Container>
-    void CopyAndSwap(Container& elements) {
-        SingleLinkedList result;
-        auto insert_after_it = before_begin();
+private:
+    // Хуки телеметрии; без SINGLE_LINKED_LIST_STATS компилятор
+    // удаляет их вызовы целиком
+    void StatsOnAllocate() noexcept {
+#ifdef SINGLE_LINKED_LIST_STATS
+        ++stats_.allocations;
+        stats_.peak_size = std::max(stats_.peak_size, size_ + 1);
+#endif
+    }
+
+    void StatsOnDeallocate() noexcept {
+#ifdef SINGLE_LINKED_LIST_STATS
+        ++stats_.deallocations;
+#endif
+    }
+
+    void StatsOnTraverse([[maybe_unused]] size_t nodes) noexcept {
+#ifdef SINGLE_LINKED_LIST_STATS
+        stats_.nodes_traversed += nodes;
+#endif
+    }
+
+    template <typename... Args>
+    Node* CreateNode(Node* next, Args&&... args) {
+        Node* new_node = NodeAllocTraits::allocate(node_alloc_, 1);
+        try {
+            NodeAllocTraits::construct(node_alloc_, new_node, next, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeAllocTraits::deallocate(node_alloc_, new_node, 1);
+            throw;
+        }
+        StatsOnAllocate();
+        return new_node;
+    }
+
+    void DestroyNode(Node* node) noexcept {
+        NodeAllocTraits::destroy(node_alloc_, node);
+        NodeAllocTraits::deallocate(node_alloc_, node, 1);
+        StatsOnDeallocate();
+    }
+
+    // Находит узел, после которого вставка value сохранит порядок:
+    // последний узел с элементом не больше value. Подсказка принимается,
+    // только если её элемент не больше value — сканирование тогда
+    // начинается с неё, а не от головы
+    template <typename Compare>
+    Node* FindSortedPosition(ConstIterator hint, const Type& value, Compare& cmp) {
+        Node* position = hint.node_ != nullptr ? hint.node_ : &head_;
+        if (position != &head_ && cmp(value, position->value)) {
+            position = &head_;
+        }
+        while (position->next_node != nullptr && !cmp(value, position->next_node->value)) {
+            position = position->next_node;
+        }
+        return position;
+    }
+
+    // Выдают итераторы; в отладочном режиме итератор штампуется
+    // текущим поколением списка для последующей проверки
+    Iterator MakeIterator(Node* node) noexcept {
+#ifdef SINGLE_LINKED_LIST_DEBUG_ITERATORS
+        return Iterator{node, this, generation_};
+#else
+        return Iterator{node};
+#endif
+    }
+
+    ConstIterator MakeConstIterator(Node* node) const noexcept {
+#ifdef SINGLE_LINKED_LIST_DEBUG_ITERATORS
+        return ConstIterator{node, this, generation_};
+#else
+        return ConstIterator{node};
+#endif
+    }
+
+    // Новое поколение объявляет все ранее выданные итераторы
+    // недействительными; зовётся только операциями, удаляющими узлы.
+    // Вставки и перестыковки итераторы односвязного списка не портят
+    void InvalidateIterators() noexcept {
+#ifdef SINGLE_LINKED_LIST_DEBUG_ITERATORS
+        ++generation_;
+#endif
+    }
+
+    // Помечает производные структуры (скип-индекс, плотную копию,
+    // хеш содержимого) устаревшими; перестройка откладывается
+    // до следующего обращения
+    void InvalidateCaches() const noexcept {
+        skip_index_valid_ = false;
+        dense_cache_valid_ = false;
+        hash_valid_ = false;
+    }
+
+    // Финальное перемешивание в духе splitmix64: размазывает биты
+    // по всему слову, чтобы суммирование вкладов не вырождалось
+    static uint64_t MixBits(uint64_t value) noexcept {
+        value += 0x9E3779B97F4A7C15ull;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+    // Вклад одного элемента: хеш значения, посоленный позицией от хвоста
+    static uint64_t MixElementHash(const Type& value, size_t position_from_tail) noexcept {
+        return MixBits(std::hash<Type>{}(value)
+                       + position_from_tail * 0x9E3779B97F4A7C15ull);
+    }
+
+    Node* NodeAt(size_t index) const {
+        if (!skip_index_valid_) {
+            BuildSkipIndex();
+        }
+        Node* node = skip_index_[index / kSkipIndexStride];
+        for (size_t residue = index % kSkipIndexStride; residue > 0; --residue) {
+            node = node->next_node;
+        }
+        return node;
+    }
+
+    void BuildSkipIndex() const {
+        skip_index_.clear();
+        size_t position = 0;
+        for (Node* node = head_.next_node; node != nullptr; node = node->next_node, ++position) {
+            if (position % kSkipIndexStride == 0) {
+                skip_index_.push_back(node);
+            }
+        }
+        skip_index_valid_ = true;
+    }
 
-        for (auto it = elements.begin(); it != elements.end(); ++it) {
-            result.InsertAfter(insert_after_it, *it);
-            ++insert_after_it;
+    static size_t SegmentCount(size_t size, size_t parallelism) noexcept {
+        return std::min(parallelism == 0 ? size_t{1} : parallelism, size);
+    }
+
+    // Разбивает цепочку из size узлов на segments частей одним проходом
+    // и выполняет body(номер_сегмента, первый_узел, длина) в отдельных
+    // потоках; последний сегмент обрабатывается текущим потоком
+    template <typename NodePtr, typename Body>
+    static void RunSegmented(NodePtr first, size_t size, size_t segments, Body body) {
+        const size_t base_length = size / segments;
+        const size_t longer_segments = size % segments;
+
+        std::vector<std::thread> workers;
+        workers.reserve(segments - 1);
+        NodePtr segment_first = first;
+        for (size_t segment = 0; segment < segments; ++segment) {
+            const size_t length = base_length + (segment < longer_segments ? 1 : 0);
+            if (segment + 1 == segments) {
+                body(segment, segment_first, length);
+            } else {
+                workers.emplace_back([&body, segment, segment_first, length] {
+                    body(segment, segment_first, length);
+                });
+                for (size_t i = 0; i < length; ++i) {
+                    segment_first = segment_first->next_node;
+                }
+            }
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    template <typename NodePtr, typename Function>
+    static void ForEachImpl(NodePtr first, size_t size, Function f, size_t parallelism) {
+        const size_t segments = SegmentCount(size, parallelism);
+        if (segments <= 1) {
+            for (NodePtr node = first; node != nullptr; node = node->next_node) {
+                f(node->value);
+            }
+            return;
+        }
+        RunSegmented(first, size, segments, [&f](size_t, NodePtr segment_first, size_t count) {
+            for (NodePtr node = segment_first; count > 0; node = node->next_node, --count) {
+                f(node->value);
+            }
+        });
+    }
+
+    // Возвращает аллокатору цепочку отцепленных узлов одной пачкой
+    void ReclaimChain(Node* chain) noexcept {
+        while (chain) {
+            Node* next_node = chain->next_node;
+            DestroyNode(chain);
+            chain = next_node;
         }
-        swap(result);
     }
 
+    // Отрезает от цепочки start серию длиной до width узлов
+    // и возвращает голову остатка
+    static Node* CutRun(Node* start, size_t width) noexcept {
+        for (size_t i = 1; start != nullptr && i < width; ++i) {
+            start = start->next_node;
+        }
+        if (start == nullptr) {
+            return nullptr;
+        }
+        Node* next_run = start->next_node;
+        start->next_node = nullptr;
+        return next_run;
+    }
+
+    // Сливает две отсортированные серии, подвешивая результат после
+    // attach_after; возвращает последний узел слитой серии
+    template <typename Compare>
+    static Node* MergeRuns(Node* attach_after, Node* left, Node* right, Compare& cmp) {
+        Node* current = attach_after;
+        while (left != nullptr && right != nullptr) {
+            // Правый берётся только при строгом "меньше" — так слияние устойчиво
+            if (cmp(right->value, left->value)) {
+                current->next_node = right;
+                right = right->next_node;
+            } else {
+                current->next_node = left;
+                left = left->next_node;
+            }
+            current = current->next_node;
+        }
+        current->next_node = left != nullptr ? left : right;
+        while (current->next_node != nullptr) {
+            current = current->next_node;
+        }
+        return current;
+    }
+
+    // Сортирует отдельную null-терминированную цепочку из length узлов
+    // той же восходящей схемой, что и Sort; новая голова пишется в first
+    template <typename Compare>
+    static void SortChain(Node*& first, size_t length, Compare& cmp) {
+        if (length < 2) {
+            return;
+        }
+        Node sentinel;
+        sentinel.next_node = first;
+        for (size_t width = 1; width < length; width *= 2) {
+            Node* merged_tail = &sentinel;
+            Node* rest = sentinel.next_node;
+            while (rest) {
+                Node* left = rest;
+                Node* right = CutRun(left, width);
+                rest = CutRun(right, width);
+                merged_tail = MergeRuns(merged_tail, left, right, cmp);
+            }
+        }
+        first = sentinel.next_node;
+    }
+
+    // Сливает две отсортированные цепочки и возвращает голову результата
+    template <typename Compare>
+    static Node* MergeChains(Node* left, Node* right, Compare& cmp) {
+        Node sentinel;
+        MergeRuns(&sentinel, left, right, cmp);
+        return sentinel.next_node;
+    }
+
+    // Обменивает только содержимое списков, аллокаторы остаются на месте
+    void SwapData(SingleLinkedList& other) noexcept {
+        std::swap(head_.next_node, other.head_.next_node);
+        std::swap(tail_, other.tail_);
+        std::swap(size_, other.size_);
+        // У пустого списка хвост указывает на собственный сентинель,
+        // после обмена указатели нужно вернуть к своим head_
+        if (tail_ == &other.head_) {
+            tail_ = &head_;
+        }
+        if (other.tail_ == &head_) {
+            other.tail_ = &other.head_;
+        }
+        InvalidateCaches();
+        other.InvalidateCaches();
+        InvalidateIterators();
+        other.InvalidateIterators();
+    }
+
+
     Node head_;
+    // Последний узел списка; у пустого списка совпадает с сентинелем
+    Node* tail_ = &head_;
+    NodeAllocator node_alloc_;
     size_t size_ = 0;
+    // Ленивый скип-индекс для IteratorAt/AdvanceFast
+    mutable std::vector<Node*> skip_index_;
+    mutable bool skip_index_valid_ = false;
+    // Ленивая плотная копия значений для ToDenseView/Sum/MinMax
+    mutable std::vector<Type> dense_cache_;
+    mutable bool dense_cache_valid_ = false;
+    // Инкрементальный хеш содержимого для Hash()
+    mutable uint64_t content_hash_ = 0;
+    mutable bool hash_valid_ = false;
+#ifdef SINGLE_LINKED_LIST_DEBUG_ITERATORS
+    // Поколение растёт при каждом удалении узлов; итераторы с отставшим
+    // поколением считаются недействительными
+    uint64_t generation_ = 0;
+#endif
+#ifdef SINGLE_LINKED_LIST_STATS
+    SingleLinkedListStats stats_;
+#endif
 };
 
-template <typename Type>
-void swap(SingleLinkedList<Type>& lhs, SingleLinkedList<Type>& rhs) noexcept {
+template <typename Type, typename Allocator>
+void swap(SingleLinkedList<Type, Allocator>& lhs, SingleLinkedList<Type, Allocator>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
-template <typename Type>
-bool operator==(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+template <typename Type, typename Allocator>
+bool operator==(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
+    return lhs.EqualTo(rhs);
 }
 
-template <typename Type>
-bool operator!=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator>
+bool operator!=(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
     return !(lhs == rhs);
 }
 
-template <typename Type>
-bool operator<(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+template <typename Type, typename Allocator>
+bool operator<(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
+    return lhs.Compare(rhs) < 0;
 }
 
-template <typename Type>
-bool operator<=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return !(lhs > rhs);
+template <typename Type, typename Allocator>
+bool operator<=(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
+    return lhs.Compare(rhs) <= 0;
 }
 
-template <typename Type>
-bool operator>(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return (std::lexicographical_compare(rhs.begin(), rhs.end(), lhs.begin(), lhs.end()));
+template <typename Type, typename Allocator>
+bool operator>(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
+    return lhs.Compare(rhs) > 0;
 }
 
-template <typename Type>
-bool operator>=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return !(lhs < rhs);
-} 
\ No newline at end of file
+template <typename Type, typename Allocator>
+bool operator>=(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) {
+    return lhs.Compare(rhs) >= 0;
+}
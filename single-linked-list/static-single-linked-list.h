@@ -0,0 +1,255 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// Список фиксированной ёмкости без единой аллокации: узлы лежат в массиве
+// внутри объекта, связи — индексы вместо указателей. Все операции constexpr,
+// поэтому статические таблицы собираются на этапе компиляции: цикл
+// PushFront/InsertAfter исполняет компилятор, а в бинарь попадает готовый
+// образ. Тип элемента должен быть литеральным и конструируемым по умолчанию.
+// Удаление не поддерживается — это строитель таблиц, а не общий контейнер
+template <typename Type, size_t Capacity>
+class StaticSingleLinkedList {
+    // Фиктивный узел перед первым элементом занимает настоящий слот
+    // массива сразу за элементами: его next_index хранит голову списка,
+    // а инкремент итератора before_begin() — обычное чтение связи,
+    // без выхода за границы массива. kNullIndex — единственный индекс,
+    // по которому итератор не продвигается
+    static constexpr size_t kBeforeBeginIndex = Capacity;
+    static constexpr size_t kNullIndex = Capacity + 1;
+
+    struct Node {
+        Type value{};
+        size_t next_index = kNullIndex;
+    };
+
+    template <typename ValueType>
+    class BasicIterator {
+    friend class StaticSingleLinkedList;
+
+        using NodePtr = std::conditional_t<std::is_const_v<ValueType>, const Node*, Node*>;
+
+        constexpr BasicIterator(NodePtr nodes, size_t index) noexcept
+            : nodes_(nodes)
+            , index_(index) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        constexpr BasicIterator() = default;
+
+        constexpr BasicIterator(const BasicIterator<Type>& other) noexcept
+            : nodes_(other.nodes_)
+            , index_(other.index_) {
+        }
+
+        [[nodiscard]] constexpr bool operator==(const BasicIterator& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+
+        [[nodiscard]] constexpr bool operator!=(const BasicIterator& rhs) const noexcept {
+            return index_ != rhs.index_;
+        }
+
+        constexpr BasicIterator& operator++() noexcept {
+            assert(index_ != kNullIndex);
+
+            index_ = nodes_[index_].next_index;
+            return *this;
+        }
+
+        constexpr BasicIterator operator++(int) noexcept {
+            BasicIterator old_copy(nodes_, index_);
+            ++(*this);
+            return old_copy;
+        }
+
+        [[nodiscard]] constexpr reference operator*() const noexcept {
+            assert(index_ < Capacity);
+
+            return nodes_[index_].value;
+        }
+
+        [[nodiscard]] constexpr pointer operator->() const noexcept {
+            assert(index_ < Capacity);
+
+            return &nodes_[index_].value;
+        }
+
+    private:
+        NodePtr nodes_ = nullptr;
+        size_t index_ = kNullIndex;
+    };
+
+public:
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Готовый непрерывный образ списка: значения подряд в порядке обхода.
+    // Объявленный constexpr, он вычисляется компилятором и кладётся
+    // в секцию данных — запуск процесса не тратит на него ни такта
+    struct Image {
+        std::array<Type, Capacity> values{};
+        size_t size = 0;
+
+        [[nodiscard]] constexpr const Type* begin() const noexcept {
+            return values.data();
+        }
+
+        [[nodiscard]] constexpr const Type* end() const noexcept {
+            return values.data() + size;
+        }
+    };
+
+    constexpr StaticSingleLinkedList() = default;
+
+    [[nodiscard]] constexpr Iterator before_begin() noexcept {
+        return Iterator{nodes_, kBeforeBeginIndex};
+    }
+
+    [[nodiscard]] constexpr ConstIterator before_begin() const noexcept {
+        return ConstIterator{nodes_, kBeforeBeginIndex};
+    }
+
+    [[nodiscard]] constexpr ConstIterator cbefore_begin() const noexcept {
+        return before_begin();
+    }
+
+    [[nodiscard]] constexpr Iterator begin() noexcept {
+        return Iterator{nodes_, nodes_[kBeforeBeginIndex].next_index};
+    }
+
+    [[nodiscard]] constexpr Iterator end() noexcept {
+        return Iterator{nodes_, kNullIndex};
+    }
+
+    [[nodiscard]] constexpr ConstIterator begin() const noexcept {
+        return ConstIterator{nodes_, nodes_[kBeforeBeginIndex].next_index};
+    }
+
+    [[nodiscard]] constexpr ConstIterator end() const noexcept {
+        return ConstIterator{nodes_, kNullIndex};
+    }
+
+    [[nodiscard]] constexpr ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] constexpr ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    [[nodiscard]] constexpr size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    constexpr void PushFront(const Type& value) {
+        InsertAfter(cbefore_begin(), value);
+    }
+
+    // Вставляет value после pos; pos может быть before_begin().
+    // Возвращает итератор на вставленный элемент
+    constexpr Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        assert(size_ < Capacity);
+        assert(pos.index_ <= kBeforeBeginIndex);
+
+        const size_t new_index = size_;
+        nodes_[new_index].value = value;
+        nodes_[new_index].next_index = nodes_[pos.index_].next_index;
+        nodes_[pos.index_].next_index = new_index;
+        ++size_;
+        return Iterator{nodes_, new_index};
+    }
+
+    // Снимает непрерывный образ: один проход по связям в порядке обхода
+    [[nodiscard]] constexpr Image ToImage() const {
+        Image image;
+        for (size_t index = nodes_[kBeforeBeginIndex].next_index; index != kNullIndex;
+             index = nodes_[index].next_index) {
+            image.values[image.size] = nodes_[index].value;
+            ++image.size;
+        }
+        return image;
+    }
+
+private:
+    // Последний слот — фиктивный узел before_begin, его next_index
+    // указывает на голову списка
+    Node nodes_[Capacity + 1]{};
+    size_t size_ = 0;
+};
+
+// Сравнения вручную разворачивают std::equal и lexicographical_compare:
+// в C++17 сами алгоритмы ещё не constexpr
+template <typename Type, size_t LhsCapacity, size_t RhsCapacity>
+[[nodiscard]] constexpr bool operator==(const StaticSingleLinkedList<Type, LhsCapacity>& lhs,
+                                        const StaticSingleLinkedList<Type, RhsCapacity>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize()) {
+        return false;
+    }
+    auto lhs_it = lhs.begin();
+    auto rhs_it = rhs.begin();
+    for (; lhs_it != lhs.end(); ++lhs_it, ++rhs_it) {
+        if (!(*lhs_it == *rhs_it)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Type, size_t LhsCapacity, size_t RhsCapacity>
+[[nodiscard]] constexpr bool operator!=(const StaticSingleLinkedList<Type, LhsCapacity>& lhs,
+                                        const StaticSingleLinkedList<Type, RhsCapacity>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t LhsCapacity, size_t RhsCapacity>
+[[nodiscard]] constexpr bool operator<(const StaticSingleLinkedList<Type, LhsCapacity>& lhs,
+                                       const StaticSingleLinkedList<Type, RhsCapacity>& rhs) {
+    auto lhs_it = lhs.begin();
+    auto rhs_it = rhs.begin();
+    for (; lhs_it != lhs.end() && rhs_it != rhs.end(); ++lhs_it, ++rhs_it) {
+        if (*lhs_it < *rhs_it) {
+            return true;
+        }
+        if (*rhs_it < *lhs_it) {
+            return false;
+        }
+    }
+    return lhs_it == lhs.end() && rhs_it != rhs.end();
+}
+
+template <typename Type, size_t LhsCapacity, size_t RhsCapacity>
+[[nodiscard]] constexpr bool operator<=(const StaticSingleLinkedList<Type, LhsCapacity>& lhs,
+                                        const StaticSingleLinkedList<Type, RhsCapacity>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t LhsCapacity, size_t RhsCapacity>
+[[nodiscard]] constexpr bool operator>(const StaticSingleLinkedList<Type, LhsCapacity>& lhs,
+                                       const StaticSingleLinkedList<Type, RhsCapacity>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t LhsCapacity, size_t RhsCapacity>
+[[nodiscard]] constexpr bool operator>=(const StaticSingleLinkedList<Type, LhsCapacity>& lhs,
+                                        const StaticSingleLinkedList<Type, RhsCapacity>& rhs) {
+    return !(lhs < rhs);
+}